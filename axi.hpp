@@ -0,0 +1,586 @@
+/**
+ * @file axi.hpp
+ * @author Wuqiong Zhao (me@wqzhao.org), et al.
+ * @brief AXI Data Movement for FLAMES
+ * @version 0.1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023 Wuqiong Zhao
+ *
+ */
+
+#ifndef _FLAMES_AXI_HPP_
+#define _FLAMES_AXI_HPP_
+
+#ifndef _FLAMES_CORE_HPP_
+#    include "core.hpp"
+#endif
+#ifndef _FLAMES_TENSOR_HPP_
+#    include "tensor.hpp"
+#endif
+#include <ap_axi_sdata.h>
+#include <cstdint>
+#include <hls_stream.h>
+
+#ifndef FLAMES_AXI_WORD_BITS
+#    define FLAMES_AXI_WORD_BITS 512
+#endif
+
+namespace flames {
+
+/// The default memory word of AXI bursts (set by macro `FLAMES_AXI_WORD_BITS`).
+using AxiWord = ap_uint<FLAMES_AXI_WORD_BITS>;
+
+/**
+ * @brief Get the raw bits of an integer.
+ *
+ * @tparam T The integer type.
+ * @param x The value.
+ * @return (ap_uint<MatBits<T>::value>) The raw bits.
+ */
+template <typename T, std::enable_if_t<std::is_integral<T>::value, bool> = true>
+static inline ap_uint<MatBits<T>::value> _toBits(const T& x) {
+    FLAMES_PRAGMA(INLINE)
+    return x;
+}
+
+/**
+ * @brief Get the raw bits of a float.
+ *
+ * @param x The value.
+ * @return (ap_uint<32>) The raw bits.
+ */
+static inline ap_uint<32> _toBits(const float& x) {
+    FLAMES_PRAGMA(INLINE)
+    union {
+        float f;
+        uint32_t u;
+    } conv;
+    conv.f = x;
+    return conv.u;
+}
+
+/**
+ * @brief Get the raw bits of a double.
+ *
+ * @param x The value.
+ * @return (ap_uint<64>) The raw bits.
+ */
+static inline ap_uint<64> _toBits(const double& x) {
+    FLAMES_PRAGMA(INLINE)
+    union {
+        double f;
+        uint64_t u;
+    } conv;
+    conv.f = x;
+    return conv.u;
+}
+
+/**
+ * @brief Get the raw bits of an arbitrary precision integer.
+ *
+ * @tparam AP_W The bit width.
+ * @tparam AP_S Whether it is signed.
+ * @param x The value.
+ * @return (ap_uint<AP_W>) The raw bits.
+ */
+template <int AP_W, bool AP_S>
+static inline ap_uint<AP_W> _toBits(const ap_int_base<AP_W, AP_S>& x) {
+    FLAMES_PRAGMA(INLINE)
+    return x.range(AP_W - 1, 0);
+}
+
+/**
+ * @brief Get the raw bits of an arbitrary precision fixed-point number.
+ *
+ * @tparam AP_W The bit width.
+ * @tparam AP_I The integer bit width.
+ * @tparam AP_S Whether it is signed.
+ * @tparam AP_Q The quantization mode.
+ * @tparam AP_O The overflow mode.
+ * @tparam AP_N The saturation bits.
+ * @param x The value.
+ * @return (ap_uint<AP_W>) The raw bits.
+ */
+template <int AP_W, int AP_I, bool AP_S, ap_q_mode AP_Q, ap_o_mode AP_O, int AP_N>
+static inline ap_uint<AP_W> _toBits(const ap_fixed_base<AP_W, AP_I, AP_S, AP_Q, AP_O, AP_N>& x) {
+    FLAMES_PRAGMA(INLINE)
+    return x.range(AP_W - 1, 0);
+}
+
+/**
+ * @brief Get the raw bits of a complex number (real part in the lower half).
+ *
+ * @tparam T The part type.
+ * @param x The value.
+ * @return (ap_uint<MatBits<std::complex<T>>::value>) The raw bits.
+ */
+template <typename T>
+static inline ap_uint<MatBits<std::complex<T>>::value> _toBits(const std::complex<T>& x) {
+    FLAMES_PRAGMA(INLINE)
+    constexpr int W = MatBits<T>::value;
+    ap_uint<2 * W> bits;
+    bits.range(W - 1, 0)     = _toBits(x.real());
+    bits.range(2 * W - 1, W) = _toBits(x.imag());
+    return bits;
+}
+
+/**
+ * @brief Set an integer from its raw bits.
+ *
+ * @tparam T The integer type.
+ * @param x The value to be set.
+ * @param bits The raw bits.
+ */
+template <typename T, std::enable_if_t<std::is_integral<T>::value, bool> = true>
+static inline void _fromBits(T& x, const ap_uint<MatBits<T>::value>& bits) {
+    FLAMES_PRAGMA(INLINE)
+    x = static_cast<T>(bits.to_uint64());
+}
+
+/**
+ * @brief Set a float from its raw bits.
+ *
+ * @param x The value to be set.
+ * @param bits The raw bits.
+ */
+static inline void _fromBits(float& x, const ap_uint<32>& bits) {
+    FLAMES_PRAGMA(INLINE)
+    union {
+        float f;
+        uint32_t u;
+    } conv;
+    conv.u = bits.to_uint64();
+    x      = conv.f;
+}
+
+/**
+ * @brief Set a double from its raw bits.
+ *
+ * @param x The value to be set.
+ * @param bits The raw bits.
+ */
+static inline void _fromBits(double& x, const ap_uint<64>& bits) {
+    FLAMES_PRAGMA(INLINE)
+    union {
+        double f;
+        uint64_t u;
+    } conv;
+    conv.u = bits.to_uint64();
+    x      = conv.f;
+}
+
+/**
+ * @brief Set an arbitrary precision integer from its raw bits.
+ *
+ * @tparam AP_W The bit width.
+ * @tparam AP_S Whether it is signed.
+ * @param x The value to be set.
+ * @param bits The raw bits.
+ */
+template <int AP_W, bool AP_S>
+static inline void _fromBits(ap_int_base<AP_W, AP_S>& x, const ap_uint<AP_W>& bits) {
+    FLAMES_PRAGMA(INLINE)
+    x.range(AP_W - 1, 0) = bits;
+}
+
+/**
+ * @brief Set an arbitrary precision fixed-point number from its raw bits.
+ *
+ * @tparam AP_W The bit width.
+ * @tparam AP_I The integer bit width.
+ * @tparam AP_S Whether it is signed.
+ * @tparam AP_Q The quantization mode.
+ * @tparam AP_O The overflow mode.
+ * @tparam AP_N The saturation bits.
+ * @param x The value to be set.
+ * @param bits The raw bits.
+ */
+template <int AP_W, int AP_I, bool AP_S, ap_q_mode AP_Q, ap_o_mode AP_O, int AP_N>
+static inline void _fromBits(ap_fixed_base<AP_W, AP_I, AP_S, AP_Q, AP_O, AP_N>& x, const ap_uint<AP_W>& bits) {
+    FLAMES_PRAGMA(INLINE)
+    x.range(AP_W - 1, 0) = bits;
+}
+
+/**
+ * @brief Set a complex number from its raw bits (real part in the lower half).
+ *
+ * @tparam T The part type.
+ * @param x The value to be set.
+ * @param bits The raw bits.
+ */
+template <typename T>
+static inline void _fromBits(std::complex<T>& x, const ap_uint<MatBits<std::complex<T>>::value>& bits) {
+    FLAMES_PRAGMA(INLINE)
+    constexpr int W = MatBits<T>::value;
+    T re, im;
+    _fromBits(re, ap_uint<W>(bits.range(W - 1, 0)));
+    _fromBits(im, ap_uint<W>(bits.range(2 * W - 1, W)));
+    x = std::complex<T>(re, im);
+}
+
+/**
+ * @brief Unpack the elements of a wide word into a data array.
+ *
+ * @details Each word holds `word_bits / MatBits<T>::value` elements (the lowest bits first),
+ *          and the remaining high bits of a word are unused.
+ * @tparam size The number of elements of the data array.
+ * @tparam T Element type.
+ * @tparam word_bits The word width.
+ * @param data The data array.
+ * @param word The word.
+ * @param w The word index.
+ */
+template <size_t size, typename T, int word_bits>
+static inline void _unpackWord(T* data, const ap_uint<word_bits>& word, size_t w) {
+    FLAMES_PRAGMA(INLINE)
+    constexpr size_t bits     = MatBits<T>::value;
+    constexpr size_t per_word = word_bits / bits;
+    static_assert(per_word > 0, "The element should not be wider than a word.");
+WORD_UNPACK:
+    for (size_t k = 0; k != per_word; ++k) {
+        FLAMES_PRAGMA(UNROLL)
+        if (w * per_word + k < size)
+            _fromBits(data[w * per_word + k], ap_uint<bits>(word.range((k + 1) * bits - 1, k * bits)));
+    }
+}
+
+/**
+ * @brief Pack the elements of a data array into a wide word.
+ *
+ * @details The layout is the same as that of `_unpackWord`, and the unused bits are zeros.
+ * @tparam size The number of elements of the data array.
+ * @tparam T Element type.
+ * @tparam word_bits The word width.
+ * @param data The data array.
+ * @param w The word index.
+ * @return (ap_uint<word_bits>) The word.
+ */
+template <size_t size, typename T, int word_bits>
+static inline ap_uint<word_bits> _packWord(const T* data, size_t w) {
+    FLAMES_PRAGMA(INLINE)
+    constexpr size_t bits     = MatBits<T>::value;
+    constexpr size_t per_word = word_bits / bits;
+    static_assert(per_word > 0, "The element should not be wider than a word.");
+    ap_uint<word_bits> word = 0;
+WORD_PACK:
+    for (size_t k = 0; k != per_word; ++k) {
+        FLAMES_PRAGMA(UNROLL)
+        if (w * per_word + k < size) word.range((k + 1) * bits - 1, k * bits) = _toBits(data[w * per_word + k]);
+    }
+    return word;
+}
+
+/**
+ * @brief The number of wide words to hold a data array.
+ *
+ * @tparam size The number of elements of the data array.
+ * @tparam T Element type.
+ * @tparam word_bits The word width.
+ * @return (constexpr size_t) The number of words.
+ */
+template <size_t size, typename T, int word_bits>
+inline constexpr size_t _numWords() noexcept {
+    return (size + word_bits / MatBits<T>::value - 1) / (word_bits / MatBits<T>::value);
+}
+
+/**
+ * @brief Load a data array from memory in bursts of wide words.
+ *
+ * @tparam size The number of elements.
+ * @tparam T Element type.
+ * @tparam word_bits The memory word width.
+ * @param data The data array.
+ * @param mem The memory (e.g. an m_axi interface pointer).
+ */
+template <size_t size, typename T, int word_bits>
+static void _loadBurst(T* data, const ap_uint<word_bits>* mem) {
+AXI_LOAD_BURST:
+    for (size_t w = 0; w != _numWords<size, T, word_bits>(); ++w) {
+        FLAMES_PRAGMA(PIPELINE II = 1)
+        _unpackWord<size>(data, mem[w], w);
+    }
+}
+
+/**
+ * @brief Store a data array to memory in bursts of wide words.
+ *
+ * @tparam size The number of elements.
+ * @tparam T Element type.
+ * @tparam word_bits The memory word width.
+ * @param data The data array.
+ * @param mem The memory (e.g. an m_axi interface pointer).
+ */
+template <size_t size, typename T, int word_bits>
+static void _storeBurst(const T* data, ap_uint<word_bits>* mem) {
+AXI_STORE_BURST:
+    for (size_t w = 0; w != _numWords<size, T, word_bits>(); ++w) {
+        FLAMES_PRAGMA(PIPELINE II = 1)
+        mem[w] = _packWord<size, T, word_bits>(data, w);
+    }
+}
+
+/**
+ * @brief Load a matrix from memory in bursts of wide words.
+ *
+ * @details The stored data array is transferred as is, so packed MatTypes (e.g. UPPER)
+ *          only move their stored elements.
+ *          Each word holds `word_bits / MatBits<T>::value` elements (the lowest bits first),
+ *          and the matrix occupies
+ *          `ceil(size() / (word_bits / MatBits<T>::value))` words.
+ *          One word is read per cycle, so the storage of the matrix should allow writing all elements of a word
+ *          in parallel (e.g. a `MatPacked` or a cyclic partition by the elements per word).
+ *          In a DATAFLOW region, the load overlaps with the compute processes of the previous matrix.
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam type Matrix type.
+ * @tparam order Storage order.
+ * @tparam word_bits The memory word width (e.g. `FLAMES_AXI_WORD_BITS` of `AxiWord`).
+ * @param mat The matrix to be loaded.
+ * @param mem The memory (e.g. an m_axi interface pointer).
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename order, int word_bits>
+static inline void loadBurst(Mat<T, n_rows, n_cols, type, order>& mat, const ap_uint<word_bits>* mem) {
+    _loadBurst<Mat<T, n_rows, n_cols, type, order>::size()>(mat.rawDataPtr(), mem);
+}
+
+/**
+ * @brief Store a matrix to memory in bursts of wide words.
+ *
+ * @details The layout in memory is the same as that of `loadBurst`.
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam type Matrix type.
+ * @tparam order Storage order.
+ * @tparam word_bits The memory word width (e.g. `FLAMES_AXI_WORD_BITS` of `AxiWord`).
+ * @param mat The matrix to be stored.
+ * @param mem The memory (e.g. an m_axi interface pointer).
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename order, int word_bits>
+static inline void storeBurst(const Mat<T, n_rows, n_cols, type, order>& mat, ap_uint<word_bits>* mem) {
+    _storeBurst<Mat<T, n_rows, n_cols, type, order>::size()>(mat.rawDataPtr(), mem);
+}
+
+/**
+ * @brief Load a tensor from memory in bursts of wide words.
+ *
+ * @details The stored data array (in the order of the tensor layout) is transferred as is.
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam n_slices Number of slices.
+ * @tparam type Matrix type of slices.
+ * @tparam layout The data layout policy.
+ * @tparam word_bits The memory word width (e.g. `FLAMES_AXI_WORD_BITS` of `AxiWord`).
+ * @param ten The tensor to be loaded.
+ * @param mem The memory (e.g. an m_axi interface pointer).
+ */
+template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type, TensorLayout layout, int word_bits>
+static inline void loadBurst(Tensor<T, n_rows, n_cols, n_slices, type, layout>& ten, const ap_uint<word_bits>* mem) {
+    _loadBurst<Tensor<T, n_rows, n_cols, n_slices, type, layout>::size()>(ten.rawDataPtr(), mem);
+}
+
+/**
+ * @brief Store a tensor to memory in bursts of wide words.
+ *
+ * @details The layout in memory is the same as that of `loadBurst`.
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam n_slices Number of slices.
+ * @tparam type Matrix type of slices.
+ * @tparam layout The data layout policy.
+ * @tparam word_bits The memory word width (e.g. `FLAMES_AXI_WORD_BITS` of `AxiWord`).
+ * @param ten The tensor to be stored.
+ * @param mem The memory (e.g. an m_axi interface pointer).
+ */
+template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type, TensorLayout layout, int word_bits>
+static inline void storeBurst(const Tensor<T, n_rows, n_cols, n_slices, type, layout>& ten, ap_uint<word_bits>* mem) {
+    _storeBurst<Tensor<T, n_rows, n_cols, n_slices, type, layout>::size()>(ten.rawDataPtr(), mem);
+}
+
+/**
+ * @brief Data width of an AXI4-Stream beat type (the width of its `data` member).
+ *
+ * @tparam AxisT The beat type (e.g. `ap_axiu<D, U, TI, TD>` or `hls::axis<ap_uint<D>, U, TI, TD>`).
+ */
+template <typename AxisT>
+struct _AxisBits : MatBits<decltype(AxisT::data)> {};
+
+/**
+ * @brief Clear the TUSER, TID and TDEST fields of a beat.
+ *
+ * @details The side channel fields of zero width do not exist in the beat type, so each one is cleared only if present.
+ * @tparam AxisT The beat type.
+ * @param beat The beat.
+ */
+template <typename AxisT>
+static inline auto _axisClearUser(AxisT& beat, int) -> decltype(beat.user = 0, void()) { beat.user = 0; }
+template <typename AxisT>
+static inline void _axisClearUser(AxisT&, long) {}
+template <typename AxisT>
+static inline auto _axisClearId(AxisT& beat, int) -> decltype(beat.id = 0, void()) { beat.id = 0; }
+template <typename AxisT>
+static inline void _axisClearId(AxisT&, long) {}
+template <typename AxisT>
+static inline auto _axisClearDest(AxisT& beat, int) -> decltype(beat.dest = 0, void()) { beat.dest = 0; }
+template <typename AxisT>
+static inline void _axisClearDest(AxisT&, long) {}
+template <typename AxisT>
+static inline void _axisClearSide(AxisT& beat) {
+    FLAMES_PRAGMA(INLINE)
+    _axisClearUser(beat, 0);
+    _axisClearId(beat, 0);
+    _axisClearDest(beat, 0);
+}
+
+/**
+ * @brief Load a data array from an AXI4-Stream.
+ *
+ * @details Each beat carries `D / MatBits<T>::value` elements (the lowest bits first),
+ *          where D is the width of the `data` member of the beat.
+ *          The beats are always consumed up to the expected number, one beat per cycle.
+ * @tparam size The number of elements.
+ * @tparam T Element type.
+ * @tparam AxisT The beat type (e.g. `ap_axiu<D, U, TI, TD>`).
+ * @param data The data array.
+ * @param s The AXI4-Stream.
+ * @param check_length Whether to check that TLAST is set on (and only on) the last expected beat.
+ * @return (bool) Whether the packet length is as expected (always true if not checked).
+ */
+template <size_t size, typename T, typename AxisT>
+static bool _loadAxis(T* data, hls::stream<AxisT>& s, bool check_length) {
+    constexpr int D          = _AxisBits<AxisT>::value;
+    constexpr size_t n_beats = _numWords<size, T, D>();
+    bool ok                  = true;
+AXIS_LOAD:
+    for (size_t w = 0; w != n_beats; ++w) {
+        FLAMES_PRAGMA(PIPELINE II = 1)
+        const AxisT beat = s.read();
+        _unpackWord<size>(data, ap_uint<D>(beat.data), w);
+        if (check_length && bool(beat.last) != (w == n_beats - 1)) ok = false;
+    }
+    return ok;
+}
+
+/**
+ * @brief Store a data array to an AXI4-Stream.
+ *
+ * @details The layout is the same as that of `_loadAxis`.
+ *          TLAST is set on the last beat, TKEEP (and TSTRB) mark all bytes
+ *          except the unused bytes at the end of the last beat, and the other side channels are zeros.
+ * @tparam size The number of elements.
+ * @tparam T Element type.
+ * @tparam AxisT The beat type (e.g. `ap_axiu<D, U, TI, TD>`).
+ * @param data The data array.
+ * @param s The AXI4-Stream.
+ */
+template <size_t size, typename T, typename AxisT>
+static void _storeAxis(const T* data, hls::stream<AxisT>& s) {
+    constexpr int D             = _AxisBits<AxisT>::value;
+    constexpr size_t n_beats    = _numWords<size, T, D>();
+    constexpr size_t per_beat   = D / MatBits<T>::value;
+    constexpr size_t last_bytes = ((size - (n_beats - 1) * per_beat) * MatBits<T>::value + 7) / 8;
+
+    const ap_uint<(D + 7) / 8> keep_all = -1;
+    ap_uint<(D + 7) / 8> keep_last      = 0;
+    keep_last.range(last_bytes - 1, 0)  = ap_uint<last_bytes>(-1);
+AXIS_STORE:
+    for (size_t w = 0; w != n_beats; ++w) {
+        FLAMES_PRAGMA(PIPELINE II = 1)
+        AxisT beat;
+        beat.data = _packWord<size, T, D>(data, w);
+        beat.keep = w == n_beats - 1 ? keep_last : keep_all;
+        beat.strb = beat.keep;
+        beat.last = w == n_beats - 1;
+        _axisClearSide(beat);
+        s.write(beat);
+    }
+}
+
+/**
+ * @brief Load a matrix from an AXI4-Stream (e.g. from a DMA).
+ *
+ * @details The stored data array is transferred as is (like `loadBurst`),
+ *          with several narrow elements packed into one beat.
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam type Matrix type.
+ * @tparam order Storage order.
+ * @tparam AxisT The beat type (e.g. `ap_axiu<D, U, TI, TD>`).
+ * @param mat The matrix to be loaded.
+ * @param s The AXI4-Stream.
+ * @param check_length Whether to check the packet length by TLAST.
+ * @return (bool) Whether the packet length is as expected (always true if not checked).
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename order, typename AxisT>
+static inline bool loadAxis(Mat<T, n_rows, n_cols, type, order>& mat, hls::stream<AxisT>& s,
+                            bool check_length = false) {
+    return _loadAxis<Mat<T, n_rows, n_cols, type, order>::size()>(mat.rawDataPtr(), s, check_length);
+}
+
+/**
+ * @brief Store a matrix to an AXI4-Stream (e.g. to a DMA).
+ *
+ * @details The layout is the same as that of `loadAxis`, and TLAST is set on the last beat.
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam type Matrix type.
+ * @tparam order Storage order.
+ * @tparam AxisT The beat type (e.g. `ap_axiu<D, U, TI, TD>`).
+ * @param mat The matrix to be stored.
+ * @param s The AXI4-Stream.
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename order, typename AxisT>
+static inline void storeAxis(const Mat<T, n_rows, n_cols, type, order>& mat, hls::stream<AxisT>& s) {
+    _storeAxis<Mat<T, n_rows, n_cols, type, order>::size()>(mat.rawDataPtr(), s);
+}
+
+/**
+ * @brief Load a tensor from an AXI4-Stream (e.g. from a DMA).
+ *
+ * @details The stored data array (in the order of the tensor layout) is transferred as is.
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam n_slices Number of slices.
+ * @tparam type Matrix type of slices.
+ * @tparam layout The data layout policy.
+ * @tparam AxisT The beat type (e.g. `ap_axiu<D, U, TI, TD>`).
+ * @param ten The tensor to be loaded.
+ * @param s The AXI4-Stream.
+ * @param check_length Whether to check the packet length by TLAST.
+ * @return (bool) Whether the packet length is as expected (always true if not checked).
+ */
+template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type, TensorLayout layout, typename AxisT>
+static inline bool loadAxis(Tensor<T, n_rows, n_cols, n_slices, type, layout>& ten, hls::stream<AxisT>& s,
+                            bool check_length = false) {
+    return _loadAxis<Tensor<T, n_rows, n_cols, n_slices, type, layout>::size()>(ten.rawDataPtr(), s, check_length);
+}
+
+/**
+ * @brief Store a tensor to an AXI4-Stream (e.g. to a DMA).
+ *
+ * @details The layout is the same as that of `loadAxis`, and TLAST is set on the last beat.
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam n_slices Number of slices.
+ * @tparam type Matrix type of slices.
+ * @tparam layout The data layout policy.
+ * @tparam AxisT The beat type (e.g. `ap_axiu<D, U, TI, TD>`).
+ * @param ten The tensor to be stored.
+ * @param s The AXI4-Stream.
+ */
+template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type, TensorLayout layout, typename AxisT>
+static inline void storeAxis(const Tensor<T, n_rows, n_cols, n_slices, type, layout>& ten, hls::stream<AxisT>& s) {
+    _storeAxis<Tensor<T, n_rows, n_cols, n_slices, type, layout>::size()>(ten.rawDataPtr(), s);
+}
+
+} // namespace flames
+
+#endif
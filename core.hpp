@@ -18,6 +18,7 @@
 #include <complex>
 #include <cstddef>
 #include <fstream>
+#include <hls_stream.h>
 #include <hls_vector.h>
 #include <initializer_list>
 #include <iostream>
@@ -138,6 +139,24 @@
 #        define FLAMES_MAT_INV_UNROLL_FACTOR 32
 #    endif
 #endif
+#ifndef FLAMES_MAT_KRON_UNROLL_FACTOR
+#    ifdef FLAMES_MAT_TIMES_UNROLL_FACTOR
+#        define FLAMES_MAT_KRON_UNROLL_FACTOR FLAMES_MAT_TIMES_UNROLL_FACTOR
+#    else
+#        ifdef FLAMES_UNROLL_FACTOR
+#            define FLAMES_MAT_KRON_UNROLL_FACTOR FLAMES_UNROLL_FACTOR
+#        else
+#            define FLAMES_MAT_KRON_UNROLL_FACTOR 32
+#        endif
+#    endif
+#endif
+#ifndef FLAMES_MAT_FWHT_UNROLL_FACTOR
+#    ifdef FLAMES_UNROLL_FACTOR
+#        define FLAMES_MAT_FWHT_UNROLL_FACTOR FLAMES_UNROLL_FACTOR
+#    else
+#        define FLAMES_MAT_FWHT_UNROLL_FACTOR 32
+#    endif
+#endif
 #ifndef FLAMES_MAT_PARTITION_COMPLETE
 #    ifndef FLAMES_MAT_PARTITION_FACTOR
 #        define FLAMES_MAT_PARTITION_FACTOR 8
@@ -148,6 +167,15 @@
 #        define FLAMES_SORT_PARTITION_FACTOR 32
 #    endif
 #endif
+#ifndef FLAMES_SORT_NETWORK_REG_STAGES
+#    define FLAMES_SORT_NETWORK_REG_STAGES 2
+#endif
+#ifndef FLAMES_SORT_MERGE_WAYS
+#    define FLAMES_SORT_MERGE_WAYS 8
+#endif
+#ifndef FLAMES_SORT_BURST_LENGTH
+#    define FLAMES_SORT_BURST_LENGTH 64
+#endif
 
 #if defined __SYNTHESIS__ && defined FLAMES_PRINT_PER_MAT_COPY
 #    undef FLAMES_PRINT_PER_MAT_COPY
@@ -219,6 +247,561 @@ inline constexpr MatType matType() {
 template <int type>
 using MType = std::integral_constant<int, type>;
 
+/**
+ * @brief Matrix storage order.
+ *
+ */
+enum class MatOrder {
+    ROW_MAJOR, /**< Row major storage */
+    COL_MAJOR  /**< Column major storage (the row major storage of the transpose) */
+};
+
+/**
+ * @brief Get the class form of MatOrder.
+ *
+ * @tparam order The MatOrder enum item value.
+ */
+template <MatOrder order>
+using MOrder = std::integral_constant<MatOrder, order>;
+
+/// Row major storage order as a class type.
+using MATORDER_ROW_MAJOR = MOrder<MatOrder::ROW_MAJOR>;
+/// Column major storage order as a class type.
+using MATORDER_COL_MAJOR = MOrder<MatOrder::COL_MAJOR>;
+
+/**
+ * @brief Storage order of a matrix (or view) type.
+ *
+ * @details Types without a static `storageOrder()` are regarded as row major.
+ * @tparam M The matrix type.
+ */
+template <typename M, typename = void>
+struct MatOrderOf : MATORDER_ROW_MAJOR {};
+
+template <typename M>
+struct MatOrderOf<M, decltype(void(M::storageOrder()))> : MOrder<M::storageOrder()> {};
+
+/**
+ * @brief Whether the data arrays of two matrices share the same element order.
+ *
+ * @details DIAGONAL, SCALAR and SYM matrices are stored in the same way for both orders.
+ * @tparam M1 The first matrix type.
+ * @tparam M2 The second matrix type.
+ * @param type The MatType of the matrices.
+ * @return (constexpr bool) Whether element-wise (flat) kernels can be used.
+ */
+template <typename M1, typename M2>
+inline constexpr bool sameOrder(MatType type) noexcept {
+    return type == MatType::DIAGONAL || type == MatType::SCALAR || type == MatType::SYM ||
+           MatOrderOf<M1>::value == MatOrderOf<M2>::value;
+}
+
+/**
+ * @brief Storage order of a result computed from a matrix (or view) operand.
+ *
+ * @details The result follows the storage order of the operand, except that ASYM results are row major.
+ * @tparam M The operand matrix type.
+ * @tparam type The MatType of the result.
+ */
+template <typename M, MatType type>
+using ResultOrder = std::conditional_t<type == MatType::ASYM, MATORDER_ROW_MAJOR, MOrder<MatOrderOf<M>::value>>;
+
+/**
+ * @brief Loop to be unrolled by a per-call parallelism policy.
+ *
+ */
+enum class ParLoop {
+    AUTO, /**< Follow the storage order of the operands, then of the result (see `_gemmUnrollCols`) */
+    ROWS, /**< Unroll the row loop */
+    COLS  /**< Unroll the column loop */
+};
+
+/**
+ * @brief Per-call parallelism policy.
+ *
+ * @details Pass it as the first template argument of a kernel, e.g. `C.mul<Par<16>>(A, B)`,
+ *          to override the global `FLAMES_MAT_*_UNROLL_FACTOR` of that single call.
+ *          Calls without a policy keep using the macros.
+ * @tparam factor_ The unroll factor.
+ * @tparam loop_ The loop to be unrolled (only used by matrix multiplication).
+ */
+template <size_t factor_, ParLoop loop_ = ParLoop::AUTO>
+struct Par {
+    static_assert(factor_ > 0, "The unroll factor should be positive.");
+    static constexpr size_t factor = factor_;
+    static constexpr ParLoop loop  = loop_;
+};
+
+/**
+ * @brief Whether a type is a parallelism policy (Par).
+ *
+ * @tparam P The type to be checked.
+ */
+template <typename P>
+struct IsPar : std::false_type {};
+
+template <size_t factor_, ParLoop loop_>
+struct IsPar<Par<factor_, loop_>> : std::true_type {};
+
+/**
+ * @brief Array partition kind of a storage policy.
+ *
+ */
+enum class MatPartition {
+    NONE,     /**< No partition */
+    BLOCK,    /**< Block partition */
+    CYCLIC,   /**< Cyclic partition */
+    COMPLETE, /**< Complete partition (registers) */
+    PACKED    /**< Cyclic reshape, i.e. `factor` consecutive elements are packed into one wide word */
+};
+
+/**
+ * @brief Storage implementation (BIND_STORAGE) of a storage policy.
+ *
+ */
+enum class MatBind {
+    AUTO,  /**< Let the tool decide */
+    BRAM,  /**< Block RAM */
+    URAM,  /**< UltraRAM */
+    LUTRAM /**< Distributed (LUT) RAM */
+};
+
+/**
+ * @brief Storage policy of a data array.
+ *
+ * @details The data array is one-dimensional, so the partition always applies to its only dimension.
+ *          The storage binding is ignored for a complete partition (registers).
+ * @tparam partition_ The array partition kind.
+ * @tparam factor_ The partition factor (for block and cyclic partitions).
+ * @tparam bind_ The storage implementation.
+ * @tparam latency_ The storage latency (-1 to let the tool decide).
+ */
+template <MatPartition partition_, size_t factor_ = 1, MatBind bind_ = MatBind::AUTO, int latency_ = -1>
+struct MatStoragePolicy {
+    static constexpr MatPartition partition = partition_;
+    static constexpr size_t factor          = factor_;
+    static constexpr MatBind bind           = bind_;
+    static constexpr int latency            = latency_;
+};
+
+template <int AP_W, bool AP_S>
+std::integral_constant<size_t, AP_W> _apBits(const ap_int_base<AP_W, AP_S>*);
+
+template <int AP_W, int AP_I, bool AP_S, ap_q_mode AP_Q, ap_o_mode AP_O, int AP_N>
+std::integral_constant<size_t, AP_W> _apBits(const ap_fixed_base<AP_W, AP_I, AP_S, AP_Q, AP_O, AP_N>*);
+
+std::integral_constant<size_t, 0> _apBits(...);
+
+/**
+ * @brief The bit width of an element type.
+ *
+ * @details It is the declared width for arbitrary precision types (e.g. 8 for `ap_int<8>`)
+ *          and the object size in bits for the others.
+ * @tparam T Element type.
+ */
+template <typename T>
+struct MatBits : std::integral_constant<size_t, decltype(_apBits((T*)nullptr))::value != 0
+                                                    ? decltype(_apBits((T*)nullptr))::value
+                                                    : sizeof(T) * 8> {};
+
+template <typename T>
+struct MatBits<std::complex<T>> : std::integral_constant<size_t, 2 * MatBits<T>::value> {};
+
+/**
+ * @brief Packed storage policy of a data array.
+ *
+ * @details As many elements as fit in a `word_bits` wide word are packed into one word (by ARRAY_RESHAPE),
+ *          so that an access to a word reads or writes all of them through a single memory port.
+ *          The data array is still indexed by element, and an unrolled loop over consecutive elements
+ *          (e.g. with an unroll factor of `MatPacked<...>::factor` or a multiple of it) accesses whole words.
+ * @tparam T Element type.
+ * @tparam word_bits The word width in bits (e.g. 64 for `ap_uint<64>` words).
+ * @tparam bind_ The storage implementation.
+ * @tparam latency_ The storage latency (-1 to let the tool decide).
+ */
+template <typename T, size_t word_bits, MatBind bind_ = MatBind::AUTO, int latency_ = -1>
+struct MatPacked
+    : MatStoragePolicy<MatPartition::PACKED, (word_bits / MatBits<T>::value > 0 ? word_bits / MatBits<T>::value : 1),
+                       bind_, latency_> {};
+
+#ifdef FLAMES_MAT_PARTITION_COMPLETE
+/// Default storage policy (set by macro `FLAMES_MAT_PARTITION_COMPLETE`).
+using MATSTORAGE_DEFAULT = MatStoragePolicy<MatPartition::COMPLETE>;
+#else
+/// Default storage policy (set by macro `FLAMES_MAT_PARTITION_FACTOR`).
+using MATSTORAGE_DEFAULT = MatStoragePolicy<MatPartition::BLOCK, FLAMES_MAT_PARTITION_FACTOR>;
+#endif
+
+/**
+ * @brief Storage policy of a matrix type.
+ *
+ * @details It is `MATSTORAGE_DEFAULT` unless specialized for a matrix type, e.g.
+ *          @code{.cpp}
+ *          namespace flames {
+ *          template <>
+ *          struct MatStorage<float, 64, 64> : MatStoragePolicy<MatPartition::CYCLIC, 4, MatBind::URAM> {};
+ *          template <>
+ *          struct MatStorage<ap_int<8>, 32, 32> : MatPacked<ap_int<8>, 64, MatBind::BRAM> {};
+ *          } // namespace flames
+ *          @endcode
+ *          so that a large matrix sits in URAM, a narrow one packs 8 elements per BRAM word,
+ *          while small matrices are still partitioned by default.
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam type Matrix type.
+ * @tparam order Storage order.
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type = MatType::NORMAL,
+          typename order = MATORDER_ROW_MAJOR>
+struct MatStorage : MATSTORAGE_DEFAULT {};
+
+/**
+ * @brief The raw data array with the pragmas of a storage policy.
+ *
+ * @details It converts to a raw pointer, so that it is used in the same way as a plain array.
+ *          The pragmas are also applied when it is copied.
+ * @tparam T Element type.
+ * @tparam size The number of elements.
+ * @tparam partition The array partition kind.
+ * @tparam factor The partition factor.
+ * @tparam bind The storage implementation.
+ * @tparam latency The storage latency.
+ */
+template <typename T, size_t size, MatPartition partition, size_t factor, MatBind bind, int latency>
+struct _StorageData;
+
+#define FLAMES_STORAGE_DATA_(PART_, BIND_, PRAGMAS_)                                                                   \
+    template <typename T, size_t size, size_t factor, int latency>                                                     \
+    struct _StorageData<T, size, MatPartition::PART_, factor, MatBind::BIND_, latency> {                               \
+        _StorageData() { PRAGMAS_ }                                                                                    \
+        _StorageData(const _StorageData& d) : _StorageData() { copy(d); }                                              \
+        _StorageData& operator=(const _StorageData& d) { return copy(d); }                                             \
+        inline operator T*() { return data; }                                                                          \
+        inline operator const T*() const { return data; }                                                              \
+        _StorageData& copy(const _StorageData& d) {                                                                    \
+            for (size_t i = 0; i != size; ++i) {                                                                       \
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)                                           \
+                data[i] = d.data[i];                                                                                   \
+            }                                                                                                          \
+            return *this;                                                                                              \
+        }                                                                                                              \
+        T data[size];                                                                                                  \
+    };
+#define FLAMES_STORAGE_BIND_(IMPL_)                                                                                    \
+    FLAMES_PRAGMA(BIND_STORAGE variable = data type = ram_2p impl = IMPL_ latency = latency)
+#define FLAMES_STORAGE_BLOCK_ FLAMES_PRAGMA(ARRAY_PARTITION variable = data type = block factor = factor)
+#define FLAMES_STORAGE_CYCLIC_ FLAMES_PRAGMA(ARRAY_PARTITION variable = data type = cyclic factor = factor)
+#define FLAMES_STORAGE_COMPLETE_ FLAMES_PRAGMA(ARRAY_PARTITION variable = data type = complete)
+#define FLAMES_STORAGE_PACKED_ FLAMES_PRAGMA(ARRAY_RESHAPE variable = data type = cyclic factor = factor)
+FLAMES_STORAGE_DATA_(NONE, AUTO, )
+FLAMES_STORAGE_DATA_(NONE, BRAM, FLAMES_STORAGE_BIND_(bram))
+FLAMES_STORAGE_DATA_(NONE, URAM, FLAMES_STORAGE_BIND_(uram))
+FLAMES_STORAGE_DATA_(NONE, LUTRAM, FLAMES_STORAGE_BIND_(lutram))
+FLAMES_STORAGE_DATA_(BLOCK, AUTO, FLAMES_STORAGE_BLOCK_)
+FLAMES_STORAGE_DATA_(BLOCK, BRAM, FLAMES_STORAGE_BLOCK_ FLAMES_STORAGE_BIND_(bram))
+FLAMES_STORAGE_DATA_(BLOCK, URAM, FLAMES_STORAGE_BLOCK_ FLAMES_STORAGE_BIND_(uram))
+FLAMES_STORAGE_DATA_(BLOCK, LUTRAM, FLAMES_STORAGE_BLOCK_ FLAMES_STORAGE_BIND_(lutram))
+FLAMES_STORAGE_DATA_(CYCLIC, AUTO, FLAMES_STORAGE_CYCLIC_)
+FLAMES_STORAGE_DATA_(CYCLIC, BRAM, FLAMES_STORAGE_CYCLIC_ FLAMES_STORAGE_BIND_(bram))
+FLAMES_STORAGE_DATA_(CYCLIC, URAM, FLAMES_STORAGE_CYCLIC_ FLAMES_STORAGE_BIND_(uram))
+FLAMES_STORAGE_DATA_(CYCLIC, LUTRAM, FLAMES_STORAGE_CYCLIC_ FLAMES_STORAGE_BIND_(lutram))
+FLAMES_STORAGE_DATA_(COMPLETE, AUTO, FLAMES_STORAGE_COMPLETE_)
+FLAMES_STORAGE_DATA_(COMPLETE, BRAM, FLAMES_STORAGE_COMPLETE_)
+FLAMES_STORAGE_DATA_(COMPLETE, URAM, FLAMES_STORAGE_COMPLETE_)
+FLAMES_STORAGE_DATA_(COMPLETE, LUTRAM, FLAMES_STORAGE_COMPLETE_)
+FLAMES_STORAGE_DATA_(PACKED, AUTO, FLAMES_STORAGE_PACKED_)
+FLAMES_STORAGE_DATA_(PACKED, BRAM, FLAMES_STORAGE_PACKED_ FLAMES_STORAGE_BIND_(bram))
+FLAMES_STORAGE_DATA_(PACKED, URAM, FLAMES_STORAGE_PACKED_ FLAMES_STORAGE_BIND_(uram))
+FLAMES_STORAGE_DATA_(PACKED, LUTRAM, FLAMES_STORAGE_PACKED_ FLAMES_STORAGE_BIND_(lutram))
+#undef FLAMES_STORAGE_DATA_
+#undef FLAMES_STORAGE_BIND_
+#undef FLAMES_STORAGE_BLOCK_
+#undef FLAMES_STORAGE_CYCLIC_
+#undef FLAMES_STORAGE_COMPLETE_
+#undef FLAMES_STORAGE_PACKED_
+
+/**
+ * @brief The raw data array with the pragmas of a storage policy (class form).
+ *
+ * @tparam T Element type.
+ * @tparam size The number of elements.
+ * @tparam policy The storage policy (e.g. a MatStoragePolicy or a MatStorage).
+ */
+template <typename T, size_t size, typename policy>
+using _StorageArray = _StorageData<T, size, policy::partition, policy::factor, policy::bind, policy::latency>;
+
+/**
+ * @brief Operator implementation (BIND_OP) of an operator policy.
+ *
+ */
+enum class MatOpImpl {
+    AUTO,  /**< Let the tool decide */
+    DSP,   /**< DSP blocks (full DSP for floating point operators) */
+    FABRIC /**< Fabric (LUTs) */
+};
+
+/**
+ * @brief Operator policy of the arithmetic in matrix kernels.
+ *
+ * @details The multiplication policy applies to the products in GEMM, scalar multiplication and `emul`,
+ *          the addition policy applies to the accumulation in GEMM,
+ *          and the division policy applies to the reciprocals in `invDiag`.
+ *          A latency is only applied together with an explicit (non AUTO) implementation.
+ *          Division is only bound for float and double (the `fabric` implementation),
+ *          as integer and fixed-point division cannot be bound by BIND_OP.
+ *          Operators on other element types (e.g. std::complex) are never bound.
+ * @tparam mul_impl_ The multiplication implementation.
+ * @tparam mul_latency_ The multiplication latency (-1 to let the tool decide).
+ * @tparam add_impl_ The addition implementation.
+ * @tparam add_latency_ The addition latency (-1 to let the tool decide).
+ * @tparam div_impl_ The division implementation (only FABRIC is bound).
+ * @tparam div_latency_ The division latency (-1 to let the tool decide).
+ */
+template <MatOpImpl mul_impl_ = MatOpImpl::AUTO, int mul_latency_ = -1, MatOpImpl add_impl_ = MatOpImpl::AUTO,
+          int add_latency_ = -1, MatOpImpl div_impl_ = MatOpImpl::AUTO, int div_latency_ = -1>
+struct MatOpPolicy {
+    static constexpr MatOpImpl mul_impl = mul_impl_;
+    static constexpr int mul_latency    = mul_latency_;
+    static constexpr MatOpImpl add_impl = add_impl_;
+    static constexpr int add_latency    = add_latency_;
+    static constexpr MatOpImpl div_impl = div_impl_;
+    static constexpr int div_latency    = div_latency_;
+};
+
+/// Default operator policy (nothing is bound).
+using MATOP_DEFAULT = MatOpPolicy<>;
+
+/**
+ * @brief Operator policy of an element type.
+ *
+ * @details It is `MATOP_DEFAULT` unless specialized for an element type, e.g.
+ *          @code{.cpp}
+ *          namespace flames {
+ *          template <>
+ *          struct MatOp<ap_fixed<8, 2>> : MatOpPolicy<MatOpImpl::FABRIC> {};
+ *          template <>
+ *          struct MatOp<ap_fixed<27, 8>> : MatOpPolicy<MatOpImpl::DSP, 3, MatOpImpl::FABRIC, 1> {};
+ *          } // namespace flames
+ *          @endcode
+ *          so that narrow products are implemented in LUTs and wide ones in DSPs with a fixed latency.
+ *          The policy is selected by the element type of the result matrix.
+ * @tparam T Element type.
+ */
+template <typename T>
+struct MatOp : MATOP_DEFAULT {};
+
+/**
+ * @brief The kind of HLS operators for a type.
+ *
+ */
+enum class _OpKind {
+    NONE,  /**< Not bound */
+    INT,   /**< Integer and fixed-point (mul, add, sub) */
+    FLOAT, /**< Single precision floating point (fmul, fadd, fsub, fdiv) */
+    DOUBLE /**< Double precision floating point (dmul, dadd, dsub, ddiv) */
+};
+
+/**
+ * @brief The kind of HLS operators for a type.
+ *
+ * @details Arbitrary precision types (and the results of their operators) are detected by their base classes.
+ * @tparam T The type.
+ */
+template <typename T>
+struct _OpKindOf
+    : std::integral_constant<_OpKind, (std::is_integral<T>::value || decltype(_apBits((T*)nullptr))::value != 0)
+                                          ? _OpKind::INT
+                                          : _OpKind::NONE> {};
+
+template <>
+struct _OpKindOf<float> : std::integral_constant<_OpKind, _OpKind::FLOAT> {};
+
+template <>
+struct _OpKindOf<double> : std::integral_constant<_OpKind, _OpKind::DOUBLE> {};
+
+/**
+ * @brief A binary operator without binding.
+ *
+ * @tparam op The C++ operator ('*', '+', '-' or '/').
+ */
+template <char op>
+struct _PlainOp;
+
+/**
+ * @brief A binary operator with the BIND_OP pragma of an implementation.
+ *
+ * @details Combinations without a specialization are not bound.
+ * @tparam kind The kind of HLS operators.
+ * @tparam op The C++ operator ('*', '+', '-' or '/').
+ * @tparam impl The operator implementation.
+ * @tparam latency The operator latency.
+ */
+template <_OpKind kind, char op, MatOpImpl impl, int latency>
+struct _BindOp : _PlainOp<op> {};
+
+#define FLAMES_PLAIN_OP_(CH_, OP_)                                                                                     \
+    template <>                                                                                                        \
+    struct _PlainOp<CH_> {                                                                                             \
+        template <typename T1, typename T2>                                                                            \
+        inline static auto apply(const T1& a, const T2& b) -> decltype(a OP_ b) {                                      \
+            FLAMES_PRAGMA(INLINE)                                                                                      \
+            return a OP_ b;                                                                                            \
+        }                                                                                                              \
+    };
+#define FLAMES_BIND_OP_(KIND_, CH_, OP_, IMPL_, HLS_OP_, HLS_IMPL_)                                                    \
+    template <int latency>                                                                                             \
+    struct _BindOp<_OpKind::KIND_, CH_, MatOpImpl::IMPL_, latency> {                                                   \
+        template <typename T1, typename T2>                                                                            \
+        inline static auto apply(const T1& a, const T2& b) -> decltype(a OP_ b) {                                      \
+            FLAMES_PRAGMA(INLINE)                                                                                      \
+            decltype(a OP_ b) res = a OP_ b;                                                                           \
+            FLAMES_PRAGMA(BIND_OP variable = res op = HLS_OP_ impl = HLS_IMPL_ latency = latency)                      \
+            return res;                                                                                                \
+        }                                                                                                              \
+    };
+FLAMES_PLAIN_OP_('*', *)
+FLAMES_PLAIN_OP_('+', +)
+FLAMES_PLAIN_OP_('-', -)
+FLAMES_PLAIN_OP_('/', /)
+FLAMES_BIND_OP_(INT, '*', *, DSP, mul, dsp)
+FLAMES_BIND_OP_(INT, '*', *, FABRIC, mul, fabric)
+FLAMES_BIND_OP_(INT, '+', +, DSP, add, dsp)
+FLAMES_BIND_OP_(INT, '+', +, FABRIC, add, fabric)
+FLAMES_BIND_OP_(INT, '-', -, DSP, sub, dsp)
+FLAMES_BIND_OP_(INT, '-', -, FABRIC, sub, fabric)
+FLAMES_BIND_OP_(FLOAT, '*', *, DSP, fmul, fulldsp)
+FLAMES_BIND_OP_(FLOAT, '*', *, FABRIC, fmul, fabric)
+FLAMES_BIND_OP_(FLOAT, '+', +, DSP, fadd, fulldsp)
+FLAMES_BIND_OP_(FLOAT, '+', +, FABRIC, fadd, fabric)
+FLAMES_BIND_OP_(FLOAT, '-', -, DSP, fsub, fulldsp)
+FLAMES_BIND_OP_(FLOAT, '-', -, FABRIC, fsub, fabric)
+FLAMES_BIND_OP_(FLOAT, '/', /, FABRIC, fdiv, fabric)
+FLAMES_BIND_OP_(DOUBLE, '*', *, DSP, dmul, fulldsp)
+FLAMES_BIND_OP_(DOUBLE, '*', *, FABRIC, dmul, fabric)
+FLAMES_BIND_OP_(DOUBLE, '+', +, DSP, dadd, fulldsp)
+FLAMES_BIND_OP_(DOUBLE, '+', +, FABRIC, dadd, fabric)
+FLAMES_BIND_OP_(DOUBLE, '-', -, DSP, dsub, fulldsp)
+FLAMES_BIND_OP_(DOUBLE, '-', -, FABRIC, dsub, fabric)
+FLAMES_BIND_OP_(DOUBLE, '/', /, FABRIC, ddiv, fabric)
+#undef FLAMES_PLAIN_OP_
+#undef FLAMES_BIND_OP_
+
+/**
+ * @brief The arithmetic operators of an operator policy.
+ *
+ * @details The kind of HLS operators is decided by the result type of each operator.
+ * @tparam policy The operator policy (e.g. a MatOpPolicy or a MatOp).
+ */
+template <typename policy>
+struct _OpBind {
+    template <typename T1, typename T2>
+    inline static auto mul(const T1& a, const T2& b) -> decltype(a * b) {
+        FLAMES_PRAGMA(INLINE)
+        return _BindOp<_OpKindOf<decltype(a * b)>::value, '*', policy::mul_impl, policy::mul_latency>::apply(a, b);
+    }
+
+    template <typename T1, typename T2>
+    inline static auto add(const T1& a, const T2& b) -> decltype(a + b) {
+        FLAMES_PRAGMA(INLINE)
+        return _BindOp<_OpKindOf<decltype(a + b)>::value, '+', policy::add_impl, policy::add_latency>::apply(a, b);
+    }
+
+    template <typename T1, typename T2>
+    inline static auto sub(const T1& a, const T2& b) -> decltype(a - b) {
+        FLAMES_PRAGMA(INLINE)
+        return _BindOp<_OpKindOf<decltype(a - b)>::value, '-', policy::add_impl, policy::add_latency>::apply(a, b);
+    }
+
+    template <typename T1, typename T2>
+    inline static auto div(const T1& a, const T2& b) -> decltype(a / b) {
+        FLAMES_PRAGMA(INLINE)
+        return _BindOp<_OpKindOf<decltype(a / b)>::value, '/', policy::div_impl, policy::div_latency>::apply(a, b);
+    }
+};
+
+/**
+ * @brief Whether the GEMM kernel unrolls the columns (otherwise the rows) for the given operands.
+ *
+ * @details The unrolled lanes should read an operand along its storage order, so that they access different banks:
+ *          the rows are unrolled for a column major left matrix (mat_L(r, i) is contiguous in r),
+ *          and the columns for a row major right matrix (mat_R(i, c) is contiguous in c).
+ *          If both or neither apply, the storage order of the destination decides (columns for column major).
+ * @tparam D The destination type.
+ * @tparam ML The left matrix type.
+ * @tparam MR The right matrix type.
+ * @return (constexpr bool) Whether the columns are unrolled.
+ */
+template <typename D, typename ML, typename MR>
+inline constexpr bool _gemmUnrollCols() noexcept {
+    constexpr bool rows = MatOrderOf<std::decay_t<ML>>::value == MatOrder::COL_MAJOR;
+    constexpr bool cols = MatOrderOf<std::decay_t<MR>>::value == MatOrder::ROW_MAJOR;
+    return rows != cols ? cols : MatOrderOf<std::decay_t<D>>::value == MatOrder::COL_MAJOR;
+}
+
+/**
+ * @brief The multiply-accumulate GEMM kernel of the matrix products.
+ *
+ * @details dst(r0 + r, c0 + c) (+)= sum_i mat_L(r, i_L + i) * mat_R(i_R + i, c) for a `rows_` x `cols_` block,
+ *          with the common loop outermost, so that a product split on a block boundary is computed piece by piece.
+ *          The destination and the operands can be any matrix, view or reference with `operator()(r, c)`.
+ *          Either the rows or the columns are unrolled by `unroll_factor`,
+ *          and the products and the accumulation are bound by the operator policy `MatOp` of `T`.
+ * @tparam rows_ The row number of the block.
+ * @tparam cols_ The column number of the block.
+ * @tparam comm The common number of the piece.
+ * @tparam unroll_factor The unroll factor.
+ * @tparam unroll_cols Whether the columns (otherwise the rows) are unrolled.
+ * @tparam T The destination element type.
+ * @tparam D The destination type.
+ * @tparam ML The left matrix type.
+ * @tparam MR The right matrix type.
+ * @param dst The destination.
+ * @param mat_L The left matrix.
+ * @param mat_R The right matrix.
+ * @param r0 The row offset of the block.
+ * @param c0 The column offset of the block.
+ * @param i_L The column offset of the left matrix.
+ * @param i_R The row offset of the right matrix.
+ * @param init Whether the block is initialized (otherwise accumulated).
+ */
+template <size_t rows_, size_t cols_, size_t comm, size_t unroll_factor, bool unroll_cols, typename T, typename D,
+          typename ML, typename MR>
+static inline void _gemmAcc(D& dst, const ML& mat_L, const MR& mat_R, size_t r0 = 0, size_t c0 = 0, size_t i_L = 0,
+                            size_t i_R = 0, bool init = true) {
+    FLAMES_PRAGMA(INLINE)
+    using _Op = _OpBind<MatOp<T>>;
+    if (unroll_cols) {
+    GEMM_COLS:
+        for (size_t i = 0; i != comm; ++i) {
+        GEMM_COLS_c:
+            for (size_t c = 0; c != cols_; ++c) {
+                FLAMES_PRAGMA(UNROLL factor = unroll_factor)
+            GEMM_COLS_r:
+                for (size_t r = 0; r != rows_; ++r) {
+                    FLAMES_PRAGMA(LOOP_FLATTEN)
+                    if (init && i == 0) dst(r0 + r, c0 + c) = T(0); // initialize
+                    dst(r0 + r, c0 + c) = _Op::add(dst(r0 + r, c0 + c), _Op::mul(mat_L(r, i_L + i), mat_R(i_R + i, c)));
+                }
+            }
+        }
+        return;
+    }
+GEMM:
+    for (size_t i = 0; i != comm; ++i) {
+    GEMM_r:
+        for (size_t r = 0; r != rows_; ++r) {
+            FLAMES_PRAGMA(UNROLL factor = unroll_factor)
+        GEMM_c:
+            for (size_t c = 0; c != cols_; ++c) {
+                FLAMES_PRAGMA(LOOP_FLATTEN)
+                if (init && i == 0) dst(r0 + r, c0 + c) = T(0); // initialize
+                dst(r0 + r, c0 + c) = _Op::add(dst(r0 + r, c0 + c), _Op::mul(mat_L(r, i_L + i), mat_R(i_R + i, c)));
+            }
+        }
+    }
+}
+
 /**
  * @brief Summation type of two matrices.
  *
@@ -384,10 +967,22 @@ inline constexpr size_t slowerRow(size_t index, size_t N) {
  * @tparam n_rows Number of rows.
  * @tparam n_cols Number of columns.
  * @tparam type matrix type.
+ * @tparam order Storage order (`MATORDER_ROW_MAJOR` or `MATORDER_COL_MAJOR`).
  */
-template <typename T, size_t n_rows, size_t n_cols, MatType type = MatType::NORMAL>
+template <typename T, size_t n_rows, size_t n_cols, MatType type = MatType::NORMAL,
+          typename order = MATORDER_ROW_MAJOR>
 class Mat;
 
+/**
+ * @brief Tensor data layout (and partition) policy.
+ *
+ */
+enum class TensorLayout {
+    SLICE_MAJOR,     /**< Slices stored one after another, block partitioned */
+    INTERLEAVED,     /**< Slice index innermost, each slice in its own bank */
+    PARTITION_BY_COL /**< Slices stored one after another, each slice partitioned by columns */
+};
+
 /**
  * @brief Tensor.
  *
@@ -397,8 +992,10 @@ class Mat;
  * @tparam n_cols Number of columns.
  * @tparam n_slices Number of slices.
  * @tparam type matrix type.
+ * @tparam layout The data layout policy.
  */
-template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type = MatType::NORMAL>
+template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type = MatType::NORMAL,
+          TensorLayout layout = TensorLayout::SLICE_MAJOR>
 class Tensor;
 
 /**
@@ -428,13 +1025,19 @@ using RowVec = Mat<T, 1, N>;
  * @tparam n_rows Number of rows.
  * @tparam n_cols Number of columns.
  * @tparam type Matrix type.
+ * @tparam order Storage order.
  */
-template <typename T, size_t n_rows, size_t n_cols, MatType type = MatType::NORMAL>
+template <typename T, size_t n_rows, size_t n_cols, MatType type = MatType::NORMAL,
+          typename order = MATORDER_ROW_MAJOR>
 class MatView;
 
-template <typename T, size_t n_rows, size_t n_cols, MatType type = MatType::NORMAL>
+template <typename T, size_t n_rows, size_t n_cols, MatType type = MatType::NORMAL,
+          typename order = MATORDER_ROW_MAJOR>
 class MatRef;
 
+template <typename T, size_t size_, typename policy = MATSTORAGE_DEFAULT>
+class MatWorkspace;
+
 /**
  * @brief Read only view version of the opposite of a matrix.
  *
@@ -442,8 +1045,9 @@ class MatRef;
  * @tparam n_rows Number of rows.
  * @tparam n_cols Number of columns.
  * @tparam type Matrix type.
+ * @tparam order Storage order.
  */
-template <typename T, size_t n_rows, size_t n_cols, MatType type>
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename order = MATORDER_ROW_MAJOR>
 class MatViewOpp;
 
 /**
@@ -465,8 +1069,10 @@ class MatViewT;
  * @tparam N_ Matrix dimension (unused, only to ensure it is a square matrix).
  * @tparam type Matrix type (surely DIAGONAL here).
  * @tparam type_parent Parent matrix (where it takes the diagonal) type.
+ * @tparam order_parent Parent matrix storage order.
  */
-template <typename T, size_t N, size_t N_, MatType type, typename type_parent = MATTYPE_NORMAL>
+template <typename T, size_t N, size_t N_, MatType type, typename type_parent = MATTYPE_NORMAL,
+          typename order_parent = MATORDER_ROW_MAJOR>
 class MatViewDiagMat;
 
 /**
@@ -477,8 +1083,10 @@ class MatViewDiagMat;
  * @tparam N_ Matrix dimension (unused, only to ensure it is a square matrix).
  * @tparam type Matrix type (surely NORMAL here).
  * @tparam type_parent Parent matrix (where it takes the diagonal) type.
+ * @tparam order_parent Parent matrix storage order.
  */
-template <typename T, size_t N, size_t N_, MatType type, typename type_parent = MATTYPE_NORMAL>
+template <typename T, size_t N, size_t N_, MatType type, typename type_parent = MATTYPE_NORMAL,
+          typename order_parent = MATORDER_ROW_MAJOR>
 class MatViewDiagVec;
 
 /**
@@ -489,10 +1097,26 @@ class MatViewDiagVec;
  * @tparam N_ Matrix dimension (unused, only to ensure it is a square matrix).
  * @tparam type Matrix type (surely NORMAL here).
  * @tparam type_parent Parent matrix (where it takes the diagonal) type.
+ * @tparam order_parent Parent matrix storage order.
  */
-template <typename T, size_t N, size_t N_, MatType type, typename type_parent = MATTYPE_NORMAL>
+template <typename T, size_t N, size_t N_, MatType type, typename type_parent = MATTYPE_NORMAL,
+          typename order_parent = MATORDER_ROW_MAJOR>
 class MatViewDiagRowVec;
 
+/**
+ * @brief Writable view version of a diagonal matrix as vector.
+ *
+ * @tparam T Element type.
+ * @tparam N Matrix dimension.
+ * @tparam N_ Column number (surely 1 here).
+ * @tparam type Matrix type (surely NORMAL here).
+ * @tparam type_parent Parent matrix (where it takes the diagonal) type.
+ * @tparam order_parent Parent matrix storage order.
+ */
+template <typename T, size_t N, size_t N_, MatType type, typename type_parent = MATTYPE_NORMAL,
+          typename order_parent = MATORDER_ROW_MAJOR>
+class MatRefDiag;
+
 /**
  * @brief Read only view version of a off diagonal.
  *
@@ -501,8 +1125,10 @@ class MatViewDiagRowVec;
  * @tparam N_ Matrix dimension (unused, only to ensure it is a square matrix).
  * @tparam type Matrix type (surely NORMAL here).
  * @tparam type_parent Parent matrix (where it takes the off diagonal) type.
+ * @tparam order_parent Parent matrix storage order.
  */
-template <typename T, size_t N, size_t N_, MatType type, typename type_parent = MATTYPE_NORMAL>
+template <typename T, size_t N, size_t N_, MatType type, typename type_parent = MATTYPE_NORMAL,
+          typename order_parent = MATORDER_ROW_MAJOR>
 class MatViewOffDiag;
 
 /**
@@ -540,9 +1166,10 @@ class MatViewRow;
  * @tparam n_cols Number of columns.
  * @tparam type Matrix type (surely NORMAL here).
  * @tparam type_parent Parent matrix (where it takes the colunm vectors) type.
+ * @tparam order_parent Parent matrix storage order.
  */
 template <size_t first_col, size_t last_col, typename T, size_t n_rows, size_t n_cols, MatType type,
-          typename type_parent = MATTYPE_NORMAL>
+          typename type_parent = MATTYPE_NORMAL, typename order_parent = MATORDER_ROW_MAJOR>
 class MatViewCols;
 
 /**
@@ -553,78 +1180,239 @@ class MatViewCols;
  * @tparam n_cols Number of columns.
  * @tparam type Matrix type (surely NORMAL here).
  * @tparam type_parent Parent matrix (where it takes the row vectors) type.
+ * @tparam order_parent Parent matrix storage order.
  */
 template <size_t first_row, size_t last_row, typename T, size_t n_rows, size_t n_cols, MatType type,
-          typename type_parent = MATTYPE_NORMAL>
+          typename type_parent = MATTYPE_NORMAL, typename order_parent = MATORDER_ROW_MAJOR>
 class MatViewRows;
 
 /**
- * @brief Afterwards action with initialization.
+ * @brief Offset of a block view (the row and column indexes of its first element) as a class type.
  *
- * @note This should only be used for view classes.
+ * @tparam row_ The row index of the first element.
+ * @tparam col_ The column index of the first element.
  */
-enum class InitAfterwards {
-    NONE, /**< none */
-    OPP,  /**< opposite */
-    TR    /**< transpose */
+template <size_t row_, size_t col_>
+struct MatOffset {
+    static constexpr size_t row = row_;
+    static constexpr size_t col = col_;
 };
 
-enum class Init { NONE, ZEROS, ONES };
-
-template <typename T, size_t n_rows, size_t n_cols, MatType type>
-class Mat {
-    friend class MatView<T, n_rows, n_cols, type>;
-    friend class MatViewOpp<T, n_rows, n_cols, type>;
-    friend class MatViewT<T, n_cols, n_rows, type>;
-    friend class MatViewT<T, n_rows, n_cols, type>;
-    template <typename View_T, size_t View_N, size_t View_N_, MatType View_type, typename type_parent>
-    friend class MatViewDiagMat;
-    template <typename View_T, size_t View_N, size_t View_N_, MatType View_type, typename type_parent>
-    friend class MatViewDiagVec;
-    template <typename View_T, size_t View_N, size_t View_N_, MatType View_type, typename type_parent>
-    friend class MatViewDiagRowVec;
-    template <typename View_T, size_t View_N, size_t View_N_, MatType View_type, typename type_parent>
-    friend class MatViewOffDiag;
-    template <typename View_T, size_t View_n_rows, size_t View_n_cols, MatType View_type, typename type_parent>
-    friend class MatViewCol;
-    template <typename View_T, size_t View_n_rows, size_t View_n_cols, MatType View_type, typename type_parent>
-    friend class MatViewRow;
-    template <size_t first_col, size_t last_col, typename View_T, size_t View_n_rows, size_t View_n_cols,
-              MatType View_type, typename type_parent>
-    friend class MatViewCols;
-    template <size_t first_row, size_t last_row, typename View_T, size_t View_n_rows, size_t View_n_cols,
-              MatType View_type, typename type_parent>
-    friend class MatViewRows;
-    template <typename View_T_T, size_t T_n_rows, size_t T_n_cols, size_t T_n_slices, MatType T_type>
-    friend class Tensor;
+/// Runtime offset of a block view as a class type.
+using MATOFFSET_DYNAMIC = MatOffset<size_t(-1), size_t(-1)>;
 
-  public:
-    using element_type = T;
-    using value_type   = T;
+/**
+ * @brief Shape of a matrix (or view) type.
+ *
+ * @tparam M The matrix type.
+ */
+template <typename M>
+struct _MatShape;
+
+template <template <class, size_t, size_t, MatType, class...> typename M, typename T, size_t n_rows, size_t n_cols,
+          MatType type, typename... _unused>
+struct _MatShape<M<T, n_rows, n_cols, type, _unused...>> {
+    static constexpr size_t  rows = n_rows;
+    static constexpr size_t  cols = n_cols;
+    static constexpr MatType kind = type;
+};
 
-    /**
-     * @brief Construct a new Mat object.
-     *
-     * @details This is the default constructor.
-     *          You can set the array partition using macro
-     *          `FLAMES_MAT_PARTITION_COMPLETE` to set a complete array partition
-     *          and `FLAMES_MAT_PARTITION_FACTOR` to set a block partition with the specific factor.
-     * @note Data is stored as a row major sequence.
-     */
-    Mat() {
-        static_assert(n_rows != 0, "'rows' should be no smaller than 1.");
-        static_assert(n_cols != 0, "'n_cols' should be no smaller than 1.");
-        static_assert(type == MatType::NORMAL || n_rows == n_cols, "Square matrix 'rows' should be equal to 'n_cols'.");
-#ifdef FLAMES_MAT_PARTITION_COMPLETE
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = complete)
-#else
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = block factor = FLAMES_MAT_PARTITION_FACTOR)
-#endif
-    }
+/**
+ * @brief Whether every element of a block has its own storage in the parent matrix.
+ *
+ * @details Only such blocks can be written through a MatRefBlock.
+ * @param type The parent matrix MatType.
+ * @param row The row index of the first element of the block.
+ * @param col The column index of the first element of the block.
+ * @param rows_ The row number of the block.
+ * @param cols_ The column number of the block.
+ * @return (constexpr bool) Whether the block is fully stored.
+ */
+inline constexpr bool _blockStored(MatType type, size_t row, size_t col, size_t rows_, size_t cols_) noexcept {
+    return type == MatType::NORMAL   ? true
+           : type == MatType::UPPER  ? row + rows_ <= col + 1
+           : type == MatType::LOWER  ? col + cols_ <= row + 1
+           : type == MatType::SUPPER ? row + rows_ <= col
+           : type == MatType::SLOWER ? col + cols_ <= row
+           : type == MatType::SYM    ? row + rows_ <= col + 1 || col + cols_ <= row + 1
+                                     : false;
+}
 
-    /**
-     * @brief Construct a new Mat object with initial value.
-     *
+/**
+ * @brief Read only view version of a rectangular block (submatrix).
+ *
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows of the block.
+ * @tparam n_cols Number of columns of the block.
+ * @tparam type Matrix type (surely NORMAL here).
+ * @tparam parent Parent view type (a MatView of the matrix where it takes the block).
+ * @tparam offset Block offset (`MatOffset` for a compile-time offset, or `MATOFFSET_DYNAMIC`).
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename parent, typename offset = MATOFFSET_DYNAMIC>
+class MatViewBlock;
+
+/**
+ * @brief Writable view version of a rectangular block (submatrix).
+ *
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows of the block.
+ * @tparam n_cols Number of columns of the block.
+ * @tparam type Matrix type (surely NORMAL here).
+ * @tparam parent Parent reference type (a MatRef of the matrix where it takes the block).
+ * @tparam offset Block offset (`MatOffset` for a compile-time offset, or `MATOFFSET_DYNAMIC`).
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename parent, typename offset = MATOFFSET_DYNAMIC>
+class MatRefBlock;
+
+/**
+ * @brief Read only view of two matrices concatenated horizontally, i.e. [M1 | M2].
+ *
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns (of both parts).
+ * @tparam type Matrix type (surely NORMAL here).
+ * @tparam M1 The left part type.
+ * @tparam M2 The right part type.
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename M1, typename M2>
+class MatViewHCat;
+
+/**
+ * @brief Read only view of two matrices concatenated vertically, i.e. [M1; M2].
+ *
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows (of both parts).
+ * @tparam n_cols Number of columns.
+ * @tparam type Matrix type (surely NORMAL here).
+ * @tparam M1 The top part type.
+ * @tparam M2 The bottom part type.
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename M1, typename M2>
+class MatViewVCat;
+
+/**
+ * @brief Whether a matrix type is a concatenation view.
+ *
+ * @tparam M The matrix type.
+ */
+template <typename M>
+struct _IsMatCat : std::false_type {};
+
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename M1, typename M2>
+struct _IsMatCat<MatViewHCat<T, n_rows, n_cols, type, M1, M2>> : std::true_type {};
+
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename M1, typename M2>
+struct _IsMatCat<MatViewVCat<T, n_rows, n_cols, type, M1, M2>> : std::true_type {};
+
+/**
+ * @brief The stored type of a part of a concatenation view.
+ *
+ * @details A Mat is held by a MatView (so no data is copied), and views are held by value.
+ * @tparam M The part type.
+ */
+template <typename M>
+struct _CatPart {
+    using type = M;
+};
+
+template <typename T, size_t n_rows, size_t n_cols, MatType type_, typename order>
+struct _CatPart<Mat<T, n_rows, n_cols, type_, order>> {
+    using type = MatView<T, n_rows, n_cols, type_, order>;
+};
+
+/**
+ * @brief Afterwards action with initialization.
+ *
+ * @note This should only be used for view classes.
+ */
+enum class InitAfterwards {
+    NONE, /**< none */
+    OPP,  /**< opposite */
+    TR    /**< transpose */
+};
+
+enum class Init { NONE, ZEROS, ONES };
+
+/**
+ * @brief Element order of a matrix transferred through a stream.
+ *
+ */
+enum class MatStreamOrder {
+    ROW,   /**< Row by row (all n_rows * n_cols elements) */
+    COL,   /**< Column by column (all n_rows * n_cols elements) */
+    PACKED /**< The stored elements only, in the order of the data array */
+};
+
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename order>
+class Mat {
+    friend class MatView<T, n_rows, n_cols, type, order>;
+    friend class MatViewOpp<T, n_rows, n_cols, type, order>;
+    friend class MatViewT<T, n_cols, n_rows, type>;
+    friend class MatViewT<T, n_rows, n_cols, type>;
+    template <typename View_T, size_t View_N, size_t View_N_, MatType View_type, typename type_parent,
+              typename order_parent>
+    friend class MatViewDiagMat;
+    template <typename View_T, size_t View_N, size_t View_N_, MatType View_type, typename type_parent,
+              typename order_parent>
+    friend class MatViewDiagVec;
+    template <typename View_T, size_t View_N, size_t View_N_, MatType View_type, typename type_parent,
+              typename order_parent>
+    friend class MatViewDiagRowVec;
+    template <typename View_T, size_t View_N, size_t View_N_, MatType View_type, typename type_parent,
+              typename order_parent>
+    friend class MatViewOffDiag;
+    template <typename View_T, size_t View_n_rows, size_t View_n_cols, MatType View_type, typename type_parent>
+    friend class MatViewCol;
+    template <typename View_T, size_t View_n_rows, size_t View_n_cols, MatType View_type, typename type_parent>
+    friend class MatViewRow;
+    template <size_t first_col, size_t last_col, typename View_T, size_t View_n_rows, size_t View_n_cols,
+              MatType View_type, typename type_parent, typename order_parent>
+    friend class MatViewCols;
+    template <size_t first_row, size_t last_row, typename View_T, size_t View_n_rows, size_t View_n_cols,
+              MatType View_type, typename type_parent, typename order_parent>
+    friend class MatViewRows;
+    template <typename View_T_T, size_t T_n_rows, size_t T_n_cols, size_t T_n_slices, MatType T_type,
+              TensorLayout T_layout>
+    friend class Tensor;
+
+  public:
+    using element_type = T;
+    using value_type   = T;
+    /// Read only transpose view (a row major view of the same data for a column major matrix).
+    using TView = std::conditional_t<order::value == MatOrder::COL_MAJOR, MatView<T, n_cols, n_rows, tType(type)>,
+                                     MatViewT<T, n_cols, n_rows, tType(type)>>;
+    /// Read only column view (a contiguous MatView for a column major NORMAL matrix).
+    using ColView = std::conditional_t<order::value == MatOrder::COL_MAJOR && type == MatType::NORMAL,
+                                       MatView<T, n_rows, 1>,
+                                       MatViewCol<T, n_rows, n_cols, MatType::NORMAL, MType<type>>>;
+    /// Writable column view (a contiguous MatRef for a column major NORMAL matrix).
+    using ColRef = std::conditional_t<order::value == MatOrder::COL_MAJOR && type == MatType::NORMAL,
+                                      MatRef<T, n_rows, 1>, MatRefCol<T, n_rows, n_cols, MatType::NORMAL, MType<type>>>;
+    /// Read only block view (of rows_ x cols_ at `offset`).
+    template <size_t rows_, size_t cols_, typename offset = MATOFFSET_DYNAMIC>
+    using BlockView = MatViewBlock<T, rows_, cols_, MatType::NORMAL, MatView<T, n_rows, n_cols, type, order>, offset>;
+    /// Writable block view (of rows_ x cols_ at `offset`).
+    template <size_t rows_, size_t cols_, typename offset = MATOFFSET_DYNAMIC>
+    using BlockRef = MatRefBlock<T, rows_, cols_, MatType::NORMAL, MatRef<T, n_rows, n_cols, type, order>, offset>;
+
+    /**
+     * @brief Construct a new Mat object.
+     *
+     * @details This is the default constructor.
+     *          The array partition and storage binding follow the storage policy `MatStorage`,
+     *          which is set by macros `FLAMES_MAT_PARTITION_COMPLETE` and `FLAMES_MAT_PARTITION_FACTOR` by default.
+     * @note Data is stored in the order of the `order` policy (row major by default).
+     *       A column major matrix is stored as the row major storage of its transpose.
+     */
+    Mat() {
+        static_assert(n_rows != 0, "'rows' should be no smaller than 1.");
+        static_assert(n_cols != 0, "'n_cols' should be no smaller than 1.");
+        static_assert(type == MatType::NORMAL || n_rows == n_cols, "Square matrix 'rows' should be equal to 'n_cols'.");
+    }
+
+    /**
+     * @brief Construct a new Mat object with initial value.
+     *
      * @details All values are set to the initial value you specify.
      *          You can configure macro `FLAMES_MAT_SET_VALUE_UNROLL_FACTOR`
      *          to set the initialization unroll factor.
@@ -634,11 +1422,6 @@ class Mat {
         static_assert(n_rows != 0, "'n_rows' should be no smaller than 1.");
         static_assert(n_cols != 0, "'n_cols' should be no smaller than 1.");
         static_assert(type == MatType::NORMAL || n_rows == n_cols, "Square matrix 'rows' should be equal to 'n_cols'.");
-#ifdef FLAMES_MAT_PARTITION_COMPLETE
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = complete)
-#else
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = block factor = FLAMES_MAT_PARTITION_FACTOR)
-#endif
         setValue(val);
     }
 
@@ -646,9 +1429,8 @@ class Mat {
      * @brief Copy constructor from a Mat object.
      *
      * @details Macro `FLAMES_MAT_COPY_UNROLL_FACTOR` to configure the unrolling factor.
-     *          You can set the array partition using macro
-     *          `FLAMES_MAT_PARTITION_COMPLETE` to set a complete array partition
-     *          and `FLAMES_MAT_PARTITION_FACTOR` to set a block partition with the specific factor.
+     *          The array partition and storage binding follow the storage policy `MatStorage`,
+     *          which is set by macros `FLAMES_MAT_PARTITION_COMPLETE` and `FLAMES_MAT_PARTITION_FACTOR` by default.
      * @param mat The matrix to be copied.
      */
     Mat(const Mat& mat) {
@@ -657,38 +1439,31 @@ class Mat {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
             _data[i] = mat[i];
         }
-#ifdef FLAMES_MAT_PARTITION_COMPLETE
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = complete)
-#else
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = block factor = FLAMES_MAT_PARTITION_FACTOR)
-#endif
 #ifdef FLAMES_PRINT_PER_MAT_COPY
         std::cout << "Mat copy!" << std::endl;
 #endif
     }
 
-    template <typename T2, size_t _rows, size_t _cols, MatType _type,
-              std::enable_if_t<!std::is_same<T, T2>::value && type == _type && n_rows == _rows && n_cols == _cols,
+    template <typename T2, size_t _rows, size_t _cols, MatType _type, typename _order,
+              std::enable_if_t<!std::is_same<T, T2>::value && type == _type && std::is_same<order, _order>::value &&
+                                   n_rows == _rows && n_cols == _cols,
                                bool> = true>
-    Mat(const Mat<T2, _rows, _cols, _type>& mat) {
+    Mat(const Mat<T2, _rows, _cols, _type, _order>& mat) {
     MAT_COPY:
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
             _data[i] = mat[i];
         }
-#ifdef FLAMES_MAT_PARTITION_COMPLETE
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = complete)
-#else
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = block factor = FLAMES_MAT_PARTITION_FACTOR)
-#endif
 #ifdef FLAMES_PRINT_PER_MAT_COPY
         std::cout << "Mat copy!" << std::endl;
 #endif
     }
 
-    template <typename T2, size_t _rows, size_t _cols, MatType _type,
-              std::enable_if_t<type != _type && n_rows == _rows && n_cols == _cols, bool> = true>
-    Mat(const Mat<T2, _rows, _cols, _type>& mat) {
+    template <typename T2, size_t _rows, size_t _cols, MatType _type, typename _order,
+              std::enable_if_t<(type != _type || !std::is_same<order, _order>::value) && n_rows == _rows &&
+                                   n_cols == _cols,
+                               bool> = true>
+    Mat(const Mat<T2, _rows, _cols, _type, _order>& mat) {
     MAT_COPY:
         for (size_t r = 0; r != n_rows; ++r) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
@@ -697,11 +1472,6 @@ class Mat {
                 _tryAssign(r, c, mat(r, c));
             }
         }
-#ifdef FLAMES_MAT_PARTITION_COMPLETE
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = complete)
-#else
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = block factor = FLAMES_MAT_PARTITION_FACTOR)
-#endif
 #ifdef FLAMES_PRINT_PER_MAT_COPY
         std::cout << "Mat copy!" << std::endl;
 #endif
@@ -711,22 +1481,18 @@ class Mat {
      * @brief Construct a new Mat object from std::vector.
      *
      * @param vec The std::vector storing data in row major.
-     * @details You can set the array partition using macro
-     *          `FLAMES_MAT_PARTITION_COMPLETE` to set a complete array partition
-     *          and `FLAMES_MAT_PARTITION_FACTOR` to set a block partition with the specific factor.
+     * @details The array partition and storage binding follow the storage policy `MatStorage`,
+     *          which is set by macros `FLAMES_MAT_PARTITION_COMPLETE` and `FLAMES_MAT_PARTITION_FACTOR` by default.
      */
     Mat(const std::vector<T>& vec) {
         assert(vec.size() == size() && "Initialization vector size disagrees.");
+        static_assert(sameOrder<Mat, MatView<T, n_rows, n_cols, type>>(type) || type == MatType::NORMAL,
+                      "Row major initialization of a column major triangular matrix is not supported.");
     MAT_COPY_FROM_STD_VEC:
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
-            _data[i] = vec[i];
+            _data[_storageIndex(i)] = vec[i];
         }
-#ifdef FLAMES_MAT_PARTITION_COMPLETE
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = complete)
-#else
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = block factor = FLAMES_MAT_PARTITION_FACTOR)
-#endif
 #ifdef FLAMES_PRINT_PER_MAT_COPY
         std::cout << "Mat copy!" << std::endl;
 #endif
@@ -736,16 +1502,13 @@ class Mat {
     Mat(std::initializer_list<T2> list) {
         auto list_size = list.size();
         assert(list_size <= size() && "Initializer list size should not exceed size().");
+        static_assert(sameOrder<Mat, MatView<T, n_rows, n_cols, type>>(type) || type == MatType::NORMAL,
+                      "Row major initialization of a column major triangular matrix is not supported.");
     MAT_COPY_FROM_INIT_LIST:
         for (size_t i = 0; i != list_size; ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
-            _data[i] = *(list.begin() + i);
+            _data[_storageIndex(i)] = *(list.begin() + i);
         }
-#ifdef FLAMES_MAT_PARTITION_COMPLETE
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = complete)
-#else
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = block factor = FLAMES_MAT_PARTITION_FACTOR)
-#endif
 #ifdef FLAMES_PRINT_PER_MAT_COPY
         std::cout << "Mat copy!" << std::endl;
 #endif
@@ -779,11 +1542,6 @@ class Mat {
             Mat<T, n_cols, n_rows, type> tmp(ptr, InitAfterwards::NONE);
             this->t(tmp);
         }
-#ifdef FLAMES_MAT_PARTITION_COMPLETE
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = complete)
-#else
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = block factor = FLAMES_MAT_PARTITION_FACTOR)
-#endif
 #ifdef FLAMES_PRINT_PER_MAT_COPY
         std::cout << "Mat copy!" << std::endl;
 #endif
@@ -806,11 +1564,6 @@ class Mat {
             Mat<T, n_cols, n_rows, type> tmp(ptr, InitAfterwards::NONE);
             this->t(tmp);
         }
-#ifdef FLAMES_MAT_PARTITION_COMPLETE
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = complete)
-#else
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = block factor = FLAMES_MAT_PARTITION_FACTOR)
-#endif
 #ifdef FLAMES_PRINT_PER_MAT_COPY
         std::cout << "Mat copy!" << std::endl;
 #endif
@@ -849,6 +1602,22 @@ class Mat {
                                            : (1 + n_rows) * n_rows / 2;
     }
 
+    /**
+     * @brief Get the storage order of the data array.
+     *
+     * @return (constexpr MatOrder) The storage order.
+     */
+    inline static constexpr MatOrder storageOrder() noexcept { return order::value; }
+
+    /**
+     * @brief Whether the data array is stored in column major.
+     *
+     * @details A column major matrix is stored as the row major storage of its transpose (with MatType tType(type)),
+     *          so that a column of a NORMAL matrix is contiguous in the data array.
+     * @return (constexpr bool) Whether it is column major.
+     */
+    inline static constexpr bool isColMajor() noexcept { return order::value == MatOrder::COL_MAJOR; }
+
     /**
      * @brief Get read only element by row major index from the data array.
      *
@@ -888,7 +1657,11 @@ class Mat {
         FLAMES_PRAGMA(INLINE)
         assert(r < n_rows && "Matrix row index should be within range");
         assert(c < n_cols && "Matrix col index should be within range");
-        if (type == MatType::NORMAL) {
+        static_assert(!isColMajor() || type != MatType::ASYM, "Column major ASYM matrices are not supported.");
+        if (isColMajor()) {
+            // column major storage is the row major storage of the transpose
+            return MatView<T, n_cols, n_rows, tType(type)>(_data)(c, r);
+        } else if (type == MatType::NORMAL) {
             return _data[r * n_cols + c];
         } else if (type == MatType::DIAGONAL) {
             if (r == c) return _data[r];
@@ -932,7 +1705,11 @@ class Mat {
         FLAMES_PRAGMA(INLINE)
         assert(r < n_rows && "Matrix row index should be within range");
         assert(c < n_cols && "Matrix col index should be within range");
-        if (type == MatType::NORMAL) {
+        static_assert(!isColMajor() || type != MatType::ASYM, "Column major ASYM matrices are not supported.");
+        if (isColMajor()) {
+            // column major storage is the row major storage of the transpose
+            return MatRef<T, n_cols, n_rows, tType(type)>(_data)(c, r);
+        } else if (type == MatType::NORMAL) {
             return _data[r * n_cols + c];
         } else if (type == MatType::DIAGONAL) {
             if (r == c) return _data[r];
@@ -1016,10 +1793,12 @@ class Mat {
                 assert(!"Read from a complex matrix is not currently supported.");
                 return false;
             } else {
+                static_assert(sameOrder<Mat, MatView<T, n_rows, n_cols, type>>(type) || type == MatType::NORMAL,
+                              "Row major initialization of a column major triangular matrix is not supported.");
                 std::string buf;
                 for (size_t i = 0; i != size(); ++i) {
                     std::getline(f, buf, ',');
-                    _data[i] = std::stod(buf);
+                    _data[_storageIndex(i)] = std::stod(buf);
                 }
                 return true;
             }
@@ -1031,6 +1810,127 @@ class Mat {
 #endif
     }
 
+    /**
+     * @brief Read the matrix from a stream.
+     *
+     * @details One element is read per cycle.
+     *          With `MatStreamOrder::ROW` or `MatStreamOrder::COL`, all n_rows * n_cols elements are read
+     *          and those not stored by the MatType (e.g. the lower part of an UPPER matrix) are discarded.
+     * @param s The input stream.
+     * @param s_order The element order in the stream.
+     */
+    void read(hls::stream<T>& s, MatStreamOrder s_order = MatStreamOrder::ROW) {
+        FLAMES_PRAGMA(INLINE)
+        if (s_order == MatStreamOrder::PACKED) {
+        MAT_READ_STREAM_PACKED:
+            for (size_t i = 0; i != size(); ++i) {
+                FLAMES_PRAGMA(PIPELINE II = 1)
+                _data[i] = s.read();
+            }
+        } else if (s_order == MatStreamOrder::COL) {
+        MAT_READ_STREAM_COL:
+            for (size_t c = 0; c != n_cols; ++c) {
+                for (size_t r = 0; r != n_rows; ++r) {
+                    FLAMES_PRAGMA(PIPELINE II = 1)
+                    _tryAssign(r, c, s.read());
+                }
+            }
+        } else {
+        MAT_READ_STREAM_ROW:
+            for (size_t r = 0; r != n_rows; ++r) {
+                for (size_t c = 0; c != n_cols; ++c) {
+                    FLAMES_PRAGMA(PIPELINE II = 1)
+                    _tryAssign(r, c, s.read());
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Read the matrix from a stream of vectors.
+     *
+     * @details L elements are read per cycle, and the unused lanes of the last vector are ignored.
+     *          The element order is the same as that of reading from a stream of elements.
+     * @tparam L The vector length.
+     * @param s The input stream.
+     * @param s_order The element order in the stream.
+     */
+    template <size_t L>
+    void read(hls::stream<hls::vector<T, L>>& s, MatStreamOrder s_order = MatStreamOrder::ROW) {
+        FLAMES_PRAGMA(INLINE)
+        const size_t n = s_order == MatStreamOrder::PACKED ? size() : n_rows * n_cols;
+    MAT_READ_VECTOR_STREAM:
+        for (size_t v = 0; v != (n + L - 1) / L; ++v) {
+            FLAMES_PRAGMA(PIPELINE II = 1)
+            const hls::vector<T, L> vec = s.read();
+            for (size_t k = 0; k != L; ++k) {
+                FLAMES_PRAGMA(UNROLL)
+                if (v * L + k < n) _streamSet(v * L + k, vec[k], s_order);
+            }
+        }
+    }
+
+    /**
+     * @brief Write the matrix to a stream.
+     *
+     * @details One element is written per cycle.
+     *          With `MatStreamOrder::ROW` or `MatStreamOrder::COL`, all n_rows * n_cols elements are written
+     *          (including the zeros not stored by the MatType).
+     * @param s The output stream.
+     * @param s_order The element order in the stream.
+     */
+    void write(hls::stream<T>& s, MatStreamOrder s_order = MatStreamOrder::ROW) const {
+        FLAMES_PRAGMA(INLINE)
+        if (s_order == MatStreamOrder::PACKED) {
+        MAT_WRITE_STREAM_PACKED:
+            for (size_t i = 0; i != size(); ++i) {
+                FLAMES_PRAGMA(PIPELINE II = 1)
+                s.write(_data[i]);
+            }
+        } else if (s_order == MatStreamOrder::COL) {
+        MAT_WRITE_STREAM_COL:
+            for (size_t c = 0; c != n_cols; ++c) {
+                for (size_t r = 0; r != n_rows; ++r) {
+                    FLAMES_PRAGMA(PIPELINE II = 1)
+                    s.write((*this)(r, c));
+                }
+            }
+        } else {
+        MAT_WRITE_STREAM_ROW:
+            for (size_t r = 0; r != n_rows; ++r) {
+                for (size_t c = 0; c != n_cols; ++c) {
+                    FLAMES_PRAGMA(PIPELINE II = 1)
+                    s.write((*this)(r, c));
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Write the matrix to a stream of vectors.
+     *
+     * @details L elements are written per cycle, and the unused lanes of the last vector are zeros.
+     *          The element order is the same as that of writing to a stream of elements.
+     * @tparam L The vector length.
+     * @param s The output stream.
+     * @param s_order The element order in the stream.
+     */
+    template <size_t L>
+    void write(hls::stream<hls::vector<T, L>>& s, MatStreamOrder s_order = MatStreamOrder::ROW) const {
+        FLAMES_PRAGMA(INLINE)
+        const size_t n = s_order == MatStreamOrder::PACKED ? size() : n_rows * n_cols;
+    MAT_WRITE_VECTOR_STREAM:
+        for (size_t v = 0; v != (n + L - 1) / L; ++v) {
+            FLAMES_PRAGMA(PIPELINE II = 1)
+            hls::vector<T, L> vec;
+            for (size_t k = 0; k != L; ++k) {
+                FLAMES_PRAGMA(UNROLL)
+                vec[k] = v * L + k < n ? _streamGet(v * L + k, s_order) : T(0);
+            }
+            s.write(vec);
+        }
+    }
+
     /**
      * @brief Matrix plus matrix with same MatType.
      *
@@ -1055,7 +1955,56 @@ class Mat {
     MAT_PLUS_MAT_SAME:
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
-            this->_data[i] = mat_L[i] + mat_R[i];
+            this->_data[i] = _at(mat_L, i) + _at(mat_R, i);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Matrix plus matrix with a per-call parallelism policy.
+     *
+     * @details The result is stored to 'this', with the unroll factor given by the policy
+     *          instead of `FLAMES_MAT_PLUS_UNROLL_FACTOR`, e.g. `C.add<Par<16>>(A, B)`.
+     *          Matrices of the same MatType are processed on the data arrays,
+     *          otherwise the result should be NORMAL and it is computed entry by entry.
+     * @tparam P The parallelism policy (Par).
+     * @tparam M1 The left matrix type.
+     * @tparam _unused1 (unused)
+     * @tparam M2 The right matrix type.
+     * @tparam _unused2 (unused)
+     * @tparam T1 The left matrix element type.
+     * @tparam T2 The right matrix element type.
+     * @tparam type1 The left matrix MatType.
+     * @tparam type2 The right matrix MatType.
+     * @tparam par_factor The unroll factor (from the policy).
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (Mat&) The addition result (a reference to 'this').
+     */
+    template <typename P, template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+              template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+              typename T2, MatType type1, MatType type2, size_t par_factor = P::factor,
+              std::enable_if_t<IsPar<P>::value, bool> = true>
+    Mat& add(const M1<T1, n_rows, n_cols, type1, _unused1...>& mat_L,
+             const M2<T2, n_rows, n_cols, type2, _unused2...>& mat_R) {
+        constexpr bool flat = type1 == type && type2 == type;
+        static_assert(flat || type == MatType::NORMAL,
+                      "Matrices of different MatType should be added into NORMAL.");
+        if (flat) {
+        MAT_PLUS_MAT_PAR:
+            for (size_t i = 0; i != size(); ++i) {
+                FLAMES_PRAGMA(UNROLL factor = par_factor)
+                this->_data[i] = _at(mat_L, i) + _at(mat_R, i);
+            }
+        } else {
+        MAT_PLUS_MAT_PAR_NORMAL:
+            for (size_t r = 0; r != n_rows; ++r) {
+                for (size_t c = 0; c != n_cols; ++c) {
+                    FLAMES_PRAGMA(UNROLL factor = par_factor)
+                    FLAMES_PRAGMA(LOOP_FLATTEN)
+                    (*this)(r, c) = mat_L(r, c) + mat_R(r, c);
+                }
+            }
         }
         return *this;
     }
@@ -1187,7 +2136,7 @@ class Mat {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
             for (size_t j = i; j != n_cols; ++j) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
-                this->_data[(2 * n_cols + 1 - i) * i / 2 + j - i] = mat_L(i, j) + mat_R(i, j);
+                (*this)(i, j) = mat_L(i, j) + mat_R(i, j);
             }
         }
         return *this;
@@ -1221,9 +2170,9 @@ class Mat {
     MAT_PLUS_MAT_LOWER:
         for (size_t i = 0; i != n_rows; ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
-            for (size_t j = i; j != n_cols; ++j) {
+            for (size_t j = 0; j != i + 1; ++j) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
-                this->_data[(1 + i) * i / 2 + j] = mat_L(i, j) + mat_R(i, j);
+                (*this)(i, j) = mat_L(i, j) + mat_R(i, j);
             }
         }
         return *this;
@@ -1259,7 +2208,7 @@ class Mat {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
             for (size_t j = i + 1; j != n_cols; ++j) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
-                this->_data[(2 * n_cols + 1 - i) * i / 2 + j - 2 * i - 1] = mat_L(i, j) + mat_R(i, j);
+                (*this)(i, j) = mat_L(i, j) + mat_R(i, j);
             }
         }
         return *this;
@@ -1293,9 +2242,9 @@ class Mat {
     MAT_PLUS_MAT_SLOWER:
         for (size_t i = 1; i != n_rows; ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
-            for (size_t j = 0; j != n_cols - 1; ++j) {
+            for (size_t j = 0; j != i; ++j) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
-                this->_data[(1 + i) * i / 2 + j - i] = mat_L(i, j) + mat_R(i, j);
+                (*this)(i, j) = mat_L(i, j) + mat_R(i, j);
             }
         }
         return *this;
@@ -1330,7 +2279,7 @@ class Mat {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
             for (size_t j = i; j != n_cols; ++j) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
-                this->_data[(2 * n_cols + 1 - i) * i / 2 + j - i] = mat_L(i, j) + mat_R(i, j);
+                (*this)(i, j) = mat_L(i, j) + mat_R(i, j);
             }
         }
         return *this;
@@ -1366,7 +2315,7 @@ class Mat {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
             for (size_t j = i + 1; j != n_cols; ++j) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
-                this->_data[(2 * n_cols + 1 - i) * i / 2 + j - i * 2 - 1] = mat_L(i, j) + mat_R(i, j);
+                (*this)(i, j) = mat_L(i, j) + mat_R(i, j);
             }
         }
         return *this;
@@ -1413,7 +2362,56 @@ class Mat {
     MAT_MINUS_MAT_SAME:
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_MINUS_UNROLL_FACTOR)
-            this->_data[i] = mat_L[i] - mat_R[i];
+            this->_data[i] = _at(mat_L, i) - _at(mat_R, i);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Matrix minus matrix with a per-call parallelism policy.
+     *
+     * @details The result is stored to 'this', with the unroll factor given by the policy
+     *          instead of `FLAMES_MAT_MINUS_UNROLL_FACTOR`, e.g. `C.sub<Par<16>>(A, B)`.
+     *          Matrices of the same MatType are processed on the data arrays,
+     *          otherwise the result should be NORMAL and it is computed entry by entry.
+     * @tparam P The parallelism policy (Par).
+     * @tparam M1 The left matrix type.
+     * @tparam _unused1 (unused)
+     * @tparam M2 The right matrix type.
+     * @tparam _unused2 (unused)
+     * @tparam T1 The left matrix element type.
+     * @tparam T2 The right matrix element type.
+     * @tparam type1 The left matrix MatType.
+     * @tparam type2 The right matrix MatType.
+     * @tparam par_factor The unroll factor (from the policy).
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (Mat&) The subtraction result (a reference to 'this').
+     */
+    template <typename P, template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+              template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+              typename T2, MatType type1, MatType type2, size_t par_factor = P::factor,
+              std::enable_if_t<IsPar<P>::value, bool> = true>
+    Mat& sub(const M1<T1, n_rows, n_cols, type1, _unused1...>& mat_L,
+             const M2<T2, n_rows, n_cols, type2, _unused2...>& mat_R) {
+        constexpr bool flat = type1 == type && type2 == type;
+        static_assert(flat || type == MatType::NORMAL,
+                      "Matrices of different MatType should be subtracted into NORMAL.");
+        if (flat) {
+        MAT_MINUS_MAT_PAR:
+            for (size_t i = 0; i != size(); ++i) {
+                FLAMES_PRAGMA(UNROLL factor = par_factor)
+                this->_data[i] = _at(mat_L, i) - _at(mat_R, i);
+            }
+        } else {
+        MAT_MINUS_MAT_PAR_NORMAL:
+            for (size_t r = 0; r != n_rows; ++r) {
+                for (size_t c = 0; c != n_cols; ++c) {
+                    FLAMES_PRAGMA(UNROLL factor = par_factor)
+                    FLAMES_PRAGMA(LOOP_FLATTEN)
+                    (*this)(r, c) = mat_L(r, c) - mat_R(r, c);
+                }
+            }
         }
         return *this;
     }
@@ -1546,7 +2544,7 @@ class Mat {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_MINUS_UNROLL_FACTOR)
             for (size_t j = i; j != n_cols; ++j) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
-                this->_data[(2 * n_cols + 1 - i) * i / 2 + j - i] = mat_L(i, j) - mat_R(i, j);
+                (*this)(i, j) = mat_L(i, j) - mat_R(i, j);
             }
         }
         return *this;
@@ -1580,9 +2578,9 @@ class Mat {
     MAT_MINUS_MAT_LOWER:
         for (size_t i = 0; i != n_rows; ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_MINUS_UNROLL_FACTOR)
-            for (size_t j = i; j != n_cols; ++j) {
+            for (size_t j = 0; j != i + 1; ++j) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
-                this->_data[(1 + i) * i / 2 + j] = mat_L(i, j) - mat_R(i, j);
+                (*this)(i, j) = mat_L(i, j) - mat_R(i, j);
             }
         }
         return *this;
@@ -1618,7 +2616,7 @@ class Mat {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_MINUS_UNROLL_FACTOR)
             for (size_t j = i + 1; j != n_cols; ++j) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
-                this->_data[(2 * n_cols + 1 - i) * i / 2 + j - 2 * i - 1] = mat_L(i, j) - mat_R(i, j);
+                (*this)(i, j) = mat_L(i, j) - mat_R(i, j);
             }
         }
         return *this;
@@ -1652,9 +2650,9 @@ class Mat {
     MAT_MINUS_MAT_SLOWER:
         for (size_t i = 1; i != n_rows; ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_MINUS_UNROLL_FACTOR)
-            for (size_t j = 0; j != n_cols - 1; ++j) {
+            for (size_t j = 0; j != i; ++j) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
-                this->_data[(1 + i) * i / 2 + j - i] = mat_L(i, j) - mat_R(i, j);
+                (*this)(i, j) = mat_L(i, j) - mat_R(i, j);
             }
         }
         return *this;
@@ -1689,7 +2687,7 @@ class Mat {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_MINUS_UNROLL_FACTOR)
             for (size_t j = i; j != n_cols; ++j) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
-                this->_data[(2 * n_cols + 1 - i) * i / 2 + j - i] = mat_L(i, j) - mat_R(i, j);
+                (*this)(i, j) = mat_L(i, j) - mat_R(i, j);
             }
         }
         return *this;
@@ -1725,7 +2723,7 @@ class Mat {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_MINUS_UNROLL_FACTOR)
             for (size_t j = i + 1; j != n_cols; ++j) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
-                this->_data[(2 * n_cols + 1 - i) * i / 2 + j - i * 2 - 1] = mat_L(i, j) - mat_R(i, j);
+                (*this)(i, j) = mat_L(i, j) - mat_R(i, j);
             }
         }
         return *this;
@@ -1751,7 +2749,7 @@ class Mat {
         // return this->sub(*this, mat_R);
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_MINUS_UNROLL_FACTOR)
-            _data[i] -= mat_R[i];
+            _data[i] -= _at(mat_R, i);
         }
         return *this;
     }
@@ -1780,35 +2778,63 @@ class Mat {
     MAT_SCALAR_TIMES:
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
-            _data[i] = mat[i] * s;
+            _data[i] = _Op::mul(_at(mat, i), s);
         }
         return *this;
     }
 
     /**
-     * @brief Matrix times a complex number.
+     * @brief Matrix times a scalar with a per-call parallelism policy.
      *
-     * @details This scalar is std::complex.
-     *          The result is stored to 'this'.
-     *          You may configure `FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR`
-     *          or `FLAMES_UNROLL_FACTOR` to doing multiplication in parallel.
+     * @details The result is stored to 'this', with the unroll factor given by the policy
+     *          instead of `FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR`, e.g. `C.mul<Par<4>>(A, s)`.
+     *          The scalar should be convertible to the element type of 'this'.
+     * @tparam P The parallelism policy (Par).
      * @tparam M The matrix type.
      * @tparam _unused (unused)
      * @tparam ScalarT The scalar type.
      * @tparam T2 The matrix element type.
+     * @tparam par_factor The unroll factor (from the policy).
      * @param mat The matrix.
-     * @param s The complex number.
+     * @param s The scalar.
      * @return (Mat&) The multiplication result (a reference to 'this').
      */
-    template <
-        template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename ScalarT,
-        typename T2,
-        std::enable_if_t<std::is_arithmetic<std::remove_cv_t<std::remove_reference_t<ScalarT>>>::value, bool> = true>
-    Mat& mul(const M<T2, n_rows, n_cols, type, _unused...>& mat, std::complex<ScalarT> s) {
-    MAT_SCALAR_TIMES:
+    template <typename P, template <class, size_t, size_t, MatType, class...> typename M, typename... _unused,
+              typename ScalarT, typename T2, size_t par_factor = P::factor,
+              std::enable_if_t<IsPar<P>::value && std::is_convertible<ScalarT, T>::value, bool> = true>
+    Mat& mul(const M<T2, n_rows, n_cols, type, _unused...>& mat, ScalarT s) {
+    MAT_SCALAR_TIMES_PAR:
         for (size_t i = 0; i != size(); ++i) {
-            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
-            _data[i] = mat[i] * s;
+            FLAMES_PRAGMA(UNROLL factor = par_factor)
+            _data[i] = _Op::mul(_at(mat, i), s);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Matrix times a complex number.
+     *
+     * @details This scalar is std::complex.
+     *          The result is stored to 'this'.
+     *          You may configure `FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing multiplication in parallel.
+     * @tparam M The matrix type.
+     * @tparam _unused (unused)
+     * @tparam ScalarT The scalar type.
+     * @tparam T2 The matrix element type.
+     * @param mat The matrix.
+     * @param s The complex number.
+     * @return (Mat&) The multiplication result (a reference to 'this').
+     */
+    template <
+        template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename ScalarT,
+        typename T2,
+        std::enable_if_t<std::is_arithmetic<std::remove_cv_t<std::remove_reference_t<ScalarT>>>::value, bool> = true>
+    Mat& mul(const M<T2, n_rows, n_cols, type, _unused...>& mat, std::complex<ScalarT> s) {
+    MAT_SCALAR_TIMES:
+        for (size_t i = 0; i != size(); ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
+            _data[i] = _Op::mul(_at(mat, i), s);
         }
         return *this;
     }
@@ -1833,7 +2859,7 @@ class Mat {
     MAT_SCALAR_TIMES:
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
-            _data[i] = mat[i] * s;
+            _data[i] = _Op::mul(_at(mat, i), s);
         }
         return *this;
     }
@@ -1862,7 +2888,7 @@ class Mat {
     MAT_SCALAR_TIMES:
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
-            _data[i] = mat[i] * s;
+            _data[i] = _Op::mul(_at(mat, i), s);
         }
         return *this;
     }
@@ -1885,7 +2911,7 @@ class Mat {
     MAT_SCALAR_TIMES_SELF:
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
-            _data[i] *= s;
+            _data[i] = _Op::mul(_data[i], s);
         }
         return *this;
     }
@@ -1907,7 +2933,7 @@ class Mat {
     MAT_SCALAR_TIMES_SELF:
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
-            _data[i] *= s;
+            _data[i] = _Op::mul(_data[i], s);
         }
         return *this;
     }
@@ -1927,7 +2953,7 @@ class Mat {
     MAT_SCALAR_TIMES_SELF:
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
-            _data[i] *= s;
+            _data[i] = _Op::mul(_data[i], s);
         }
         return *this;
     }
@@ -1951,7 +2977,7 @@ class Mat {
     MAT_SCALAR_TIMES_SELF:
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
-            _data[i] *= s;
+            _data[i] = _Op::mul(_data[i], s);
         }
         return *this;
     }
@@ -1992,23 +3018,194 @@ class Mat {
         FLAMES_PRAGMA(INLINE off)
         static_assert(n_rows == rows_, "Matrix dimension should meet.");
         static_assert(n_cols == cols_, "Matrix dimension should meet.");
-    GEMM:
-        for (size_t i = 0; i != comm; ++i) {
-        GEMM_r:
-            for (size_t r = 0; r != n_rows; ++r) {
-                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
-            // FLAMES_PRAGMA(DEPENDENCE variable=mat_L inter false)
-            // FLAMES_PRAGMA(DEPENDENCE variable=mat_L intra false)
-            // FLAMES_PRAGMA(DEPENDENCE variable=mat_R inter false)
-            // FLAMES_PRAGMA(DEPENDENCE variable=mat_R intra false
-            GEMM_c:
-                for (size_t c = 0; c != n_cols; ++c) {
-                    FLAMES_PRAGMA(LOOP_FLATTEN)
-                    if (i == 0) (*this)(r, c) = T(0); // initialize
-                    (*this)(r, c) += mat_L(r, i) * mat_R(i, c);
-                }
-            }
-        }
+        // unroll along the storage of the operands (or the result) so that parallel accesses hit different banks
+        constexpr bool unroll_cols = _gemmUnrollCols<Mat, decltype(mat_L), decltype(mat_R)>();
+        _gemmAcc<n_rows, n_cols, comm, FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR, unroll_cols, T>(*this, mat_L, mat_R);
+        return *this;
+    }
+
+    /**
+     * @brief Horizontal concatenation times matrix, i.e. [A | B] * X = A * X_top + B * X_bottom.
+     *
+     * @details The common loop is split on the block boundary, so each part is accessed without branching.
+     *          You may configure `FLAMES_MAT_TIMES_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing multiplication in parallel.
+     * @tparam T1 The left matrix element type.
+     * @tparam comm The common number (the column number of the left matrix and the row number of the right matrix).
+     * @tparam type1 The left matrix MatType.
+     * @tparam P1 The first part type of the left matrix.
+     * @tparam P2 The second part type of the left matrix.
+     * @tparam M2 The right matrix type.
+     * @tparam _unused2 (unused)
+     * @tparam T2 The right matrix element type.
+     * @tparam type2 The right matrix MatType.
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (Mat&) The multiplication result (a reference to 'this').
+     */
+    template <typename T1, size_t comm, MatType type1, typename P1, typename P2,
+              template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T2,
+              MatType type2>
+    Mat& mul(const MatViewHCat<T1, n_rows, comm, type1, P1, P2>& mat_L,
+             const M2<T2, comm, n_cols, type2, _unused2...>& mat_R) {
+        FLAMES_PRAGMA(INLINE off)
+        constexpr size_t comm_1 = _MatShape<P1>::cols;
+        constexpr size_t factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR;
+        constexpr bool unroll_1 = _gemmUnrollCols<Mat, decltype(mat_L._first), decltype(mat_R)>();
+        constexpr bool unroll_2 = _gemmUnrollCols<Mat, decltype(mat_L._second), decltype(mat_R)>();
+        _gemmAcc<n_rows, n_cols, comm_1, factor, unroll_1, T>(*this, mat_L._first, mat_R);
+        _gemmAcc<n_rows, n_cols, comm - comm_1, factor, unroll_2, T>(*this, mat_L._second, mat_R, 0, 0, 0, comm_1,
+                                                                     false);
+        return *this;
+    }
+
+    /**
+     * @brief Vertical concatenation times matrix, i.e. [A; B] * X = [A * X; B * X].
+     *
+     * @details The row loop is split on the block boundary, so each part is accessed without branching.
+     *          You may configure `FLAMES_MAT_TIMES_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing multiplication in parallel.
+     * @tparam T1 The left matrix element type.
+     * @tparam comm The common number (the column number of the left matrix and the row number of the right matrix).
+     * @tparam type1 The left matrix MatType.
+     * @tparam P1 The first part type of the left matrix.
+     * @tparam P2 The second part type of the left matrix.
+     * @tparam M2 The right matrix type.
+     * @tparam _unused2 (unused)
+     * @tparam T2 The right matrix element type.
+     * @tparam type2 The right matrix MatType.
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (Mat&) The multiplication result (a reference to 'this').
+     */
+    template <typename T1, size_t comm, MatType type1, typename P1, typename P2,
+              template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T2,
+              MatType type2>
+    Mat& mul(const MatViewVCat<T1, n_rows, comm, type1, P1, P2>& mat_L,
+             const M2<T2, comm, n_cols, type2, _unused2...>& mat_R) {
+        FLAMES_PRAGMA(INLINE off)
+        constexpr size_t rows_1 = _MatShape<P1>::rows;
+        constexpr size_t factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR;
+        constexpr bool unroll_1 = _gemmUnrollCols<Mat, decltype(mat_L._first), decltype(mat_R)>();
+        constexpr bool unroll_2 = _gemmUnrollCols<Mat, decltype(mat_L._second), decltype(mat_R)>();
+        _gemmAcc<rows_1, n_cols, comm, factor, unroll_1, T>(*this, mat_L._first, mat_R);
+        _gemmAcc<n_rows - rows_1, n_cols, comm, factor, unroll_2, T>(*this, mat_L._second, mat_R, rows_1);
+        return *this;
+    }
+
+    /**
+     * @brief Matrix times horizontal concatenation, i.e. X * [A | B] = [X * A | X * B].
+     *
+     * @details The column loop is split on the block boundary, so each part is accessed without branching.
+     *          You may configure `FLAMES_MAT_TIMES_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing multiplication in parallel.
+     * @tparam M1 The left matrix type.
+     * @tparam _unused1 (unused)
+     * @tparam T1 The left matrix element type.
+     * @tparam type1 The left matrix MatType.
+     * @tparam T2 The right matrix element type.
+     * @tparam comm The common number (the column number of the left matrix and the row number of the right matrix).
+     * @tparam type2 The right matrix MatType.
+     * @tparam P1 The first part type of the right matrix.
+     * @tparam P2 The second part type of the right matrix.
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (Mat&) The multiplication result (a reference to 'this').
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1, typename T1,
+              MatType type1, typename T2, size_t comm, MatType type2, typename P1, typename P2,
+              std::enable_if_t<!_IsMatCat<M1<T1, n_rows, comm, type1, _unused1...>>::value, bool> = true>
+    Mat& mul(const M1<T1, n_rows, comm, type1, _unused1...>& mat_L,
+             const MatViewHCat<T2, comm, n_cols, type2, P1, P2>& mat_R) {
+        FLAMES_PRAGMA(INLINE off)
+        constexpr size_t cols_1 = _MatShape<P1>::cols;
+        constexpr size_t factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR;
+        constexpr bool unroll_1 = _gemmUnrollCols<Mat, decltype(mat_L), decltype(mat_R._first)>();
+        constexpr bool unroll_2 = _gemmUnrollCols<Mat, decltype(mat_L), decltype(mat_R._second)>();
+        _gemmAcc<n_rows, cols_1, comm, factor, unroll_1, T>(*this, mat_L, mat_R._first);
+        _gemmAcc<n_rows, n_cols - cols_1, comm, factor, unroll_2, T>(*this, mat_L, mat_R._second, 0, cols_1);
+        return *this;
+    }
+
+    /**
+     * @brief Matrix times vertical concatenation, i.e. X * [A; B] = X_left * A + X_right * B.
+     *
+     * @details The common loop is split on the block boundary, so each part is accessed without branching.
+     *          You may configure `FLAMES_MAT_TIMES_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing multiplication in parallel.
+     * @tparam M1 The left matrix type.
+     * @tparam _unused1 (unused)
+     * @tparam T1 The left matrix element type.
+     * @tparam type1 The left matrix MatType.
+     * @tparam T2 The right matrix element type.
+     * @tparam comm The common number (the column number of the left matrix and the row number of the right matrix).
+     * @tparam type2 The right matrix MatType.
+     * @tparam P1 The first part type of the right matrix.
+     * @tparam P2 The second part type of the right matrix.
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (Mat&) The multiplication result (a reference to 'this').
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1, typename T1,
+              MatType type1, typename T2, size_t comm, MatType type2, typename P1, typename P2,
+              std::enable_if_t<!_IsMatCat<M1<T1, n_rows, comm, type1, _unused1...>>::value, bool> = true>
+    Mat& mul(const M1<T1, n_rows, comm, type1, _unused1...>& mat_L,
+             const MatViewVCat<T2, comm, n_cols, type2, P1, P2>& mat_R) {
+        FLAMES_PRAGMA(INLINE off)
+        constexpr size_t comm_1 = _MatShape<P1>::rows;
+        constexpr size_t factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR;
+        constexpr bool unroll_1 = _gemmUnrollCols<Mat, decltype(mat_L), decltype(mat_R._first)>();
+        constexpr bool unroll_2 = _gemmUnrollCols<Mat, decltype(mat_L), decltype(mat_R._second)>();
+        _gemmAcc<n_rows, n_cols, comm_1, factor, unroll_1, T>(*this, mat_L, mat_R._first);
+        _gemmAcc<n_rows, n_cols, comm - comm_1, factor, unroll_2, T>(*this, mat_L, mat_R._second, 0, 0, comm_1, 0,
+                                                                     false);
+        return *this;
+    }
+
+    /**
+     * @brief Normal matrix or symmetric matrix times normal matrix or symmetric matrix
+     *        with a per-call parallelism policy.
+     *
+     * @details The result is stored to 'this', with the unroll factor and the unrolled loop given by the policy
+     *          instead of `FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR`, e.g. `C.mul<Par<16>>(A, B)`.
+     *          By default (`ParLoop::AUTO`), the rows are unrolled for a column major left matrix
+     *          and the columns for a row major right matrix, so that parallel reads go to different banks.
+     *          If both or neither apply, the rows are unrolled for a row major result and the columns otherwise.
+     * @tparam P The parallelism policy (Par).
+     * @tparam M1 The left matrix type.
+     * @tparam _unused1 (unused)
+     * @tparam M2 The right matrix type.
+     * @tparam _unused2 (unused)
+     * @tparam T1 The left matrix element type.
+     * @tparam T2 The right matrix element type.
+     * @tparam type1 The left matrix MatType.
+     * @tparam type2 The right matrix MatType.
+     * @tparam rows_ The row number of the left matrix (should be the same as rows of 'this').
+     * @tparam cols_ The column number of the right matrix (should be the same as n_cols of 'this').
+     * @tparam comm The common number (the column number of the left matrix and the row number of the right matrix).
+     * @tparam par_factor The unroll factor (from the policy).
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (Mat&) The multiplication result (a reference to 'this').
+     */
+    template <typename P, template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+              template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+              typename T2, MatType type1, MatType type2, size_t rows_, size_t cols_, size_t comm,
+              size_t par_factor = P::factor,
+              std::enable_if_t<IsPar<P>::value && !(std::is_same<T1, bool>::value) &&
+                                   !(std::is_same<T2, bool>::value) &&
+                                   (type1 == MatType::NORMAL || type1 == MatType::SYM) &&
+                                   (type2 == MatType::NORMAL || type2 == MatType::SYM),
+                               bool> = true>
+    Mat& mul(const M1<T1, rows_, comm, type1, _unused1...>& mat_L,
+             const M2<T2, comm, cols_, type2, _unused2...>& mat_R) {
+        FLAMES_PRAGMA(INLINE off)
+        static_assert(n_rows == rows_, "Matrix dimension should meet.");
+        static_assert(n_cols == cols_, "Matrix dimension should meet.");
+        constexpr bool unroll_cols =
+            P::loop == ParLoop::COLS ||
+            (P::loop == ParLoop::AUTO && _gemmUnrollCols<Mat, decltype(mat_L), decltype(mat_R)>());
+        _gemmAcc<n_rows, n_cols, comm, par_factor, unroll_cols, T>(*this, mat_L, mat_R);
         return *this;
     }
 
@@ -5428,7 +6625,38 @@ class Mat {
               const M2<T2, rows_, cols_, type2, _unused2...>& mat_R) {
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_EMUL_UNROLL_FACTOR)
-            _data[i] = mat_L[i] * mat_R[i];
+            _data[i] = _Op::mul(_at(mat_L, i), _at(mat_R, i));
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Element-wise product of two matrices with a per-call parallelism policy.
+     *
+     * @details The unroll factor is given by the policy instead of `FLAMES_MAT_EMUL_UNROLL_FACTOR`,
+     *          e.g. `C.emul<Par<8>>(A, B)`.
+     * @note It now only supports element-wise product of two matrices of the same dimension and MatType.
+     * @tparam P The parallelism policy (Par).
+     * @tparam M1 The left matrix type.
+     * @tparam _unused1 (unused)
+     * @tparam M2 The right matrix type.
+     * @tparam _unused2 (unused)
+     * @tparam T1 The left matrix element type.
+     * @tparam T2 The right matrix element type.
+     * @tparam par_factor The unroll factor (from the policy).
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (Mat&) The element-wise product result (a reference to 'this').
+     */
+    template <typename P, template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+              template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+              typename T2, size_t par_factor = P::factor, std::enable_if_t<IsPar<P>::value, bool> = true>
+    Mat& emul(const M1<T1, n_rows, n_cols, type, _unused1...>& mat_L,
+              const M2<T2, n_rows, n_cols, type, _unused2...>& mat_R) {
+    MAT_EMUL_PAR:
+        for (size_t i = 0; i != size(); ++i) {
+            FLAMES_PRAGMA(UNROLL factor = par_factor)
+            _data[i] = _Op::mul(_at(mat_L, i), _at(mat_R, i));
         }
         return *this;
     }
@@ -5501,18 +6729,20 @@ class Mat {
     /**
      * @brief Take a column of a matrix by index as a read only view.
      *
-     * @return (MatViewCol<T, n_rows, n_cols, MatType::NORMAL, MType<type>>) The read only a column vector view.
+     * @details The column of a column major NORMAL matrix is contiguous,
+     *          so it is viewed as a MatView vector directly.
+     * @return (ColView) The read only a column vector view.
      */
-    MatViewCol<T, n_rows, n_cols, MatType::NORMAL, MType<type>> col_(size_t index) const {
+    ColView col_(size_t index) const {
         assert(index < n_cols && "Take the specific col by index requires 'The index should be smaller than the number "
                                  "of the matrix's columns.'.");
-        return { *this, index };
+        return _col_(index, std::integral_constant<bool, order::value == MatOrder::COL_MAJOR>());
     }
 
-    MatRefCol<T, n_rows, n_cols, MatType::NORMAL, MType<type>> col_(size_t index) {
+    ColRef col_(size_t index) {
         assert(index < n_cols && "Take the specific col by index requires 'The index should be smaller than the number "
                                  "of the matrix's columns.'.");
-        return { *this, index };
+        return _col_(index, std::integral_constant<bool, order::value == MatOrder::COL_MAJOR>());
     }
 
     /**
@@ -5655,11 +6885,11 @@ class Mat {
     /**
      * @brief Take seccessive columns of a matrix by indexes as a read only view.
      *
-     * @return (MatViewCols<first_row, last_row, T, n_rows, n_cols, MatType::NORMAL, MType<type>>) The read only columns
-     * vector view.
+     * @return (MatViewCols<first_row, last_row, T, n_rows, n_cols, MatType::NORMAL, MType<type>, order>) The read only
+     * columns vector view.
      */
     template <size_t first_col, size_t last_col>
-    MatViewCols<first_col, last_col, T, n_rows, n_cols, MatType::NORMAL, MType<type>> Cols_() const {
+    MatViewCols<first_col, last_col, T, n_rows, n_cols, MatType::NORMAL, MType<type>, order> Cols_() const {
         static_assert(first_col > int(0),
                       "Take the successive cols by index requires 'The first index can't be smaller than 0'.");
         static_assert(
@@ -5747,11 +6977,11 @@ class Mat {
     /**
      * @brief Take successive rows of a matrix by indexes as a read only view.
      *
-     * @return (MatViewRows<first_row, last_row, T, n_rows, n_cols, MatType::NORMAL, MType<type>>) The read only rows
-     * vector view.
+     * @return (MatViewRows<first_row, last_row, T, n_rows, n_cols, MatType::NORMAL, MType<type>, order>) The read only
+     * rows vector view.
      */
     template <size_t first_row, size_t last_row>
-    MatViewRows<first_row, last_row, T, n_rows, n_cols, MatType::NORMAL, MType<type>> Rows_() const {
+    MatViewRows<first_row, last_row, T, n_rows, n_cols, MatType::NORMAL, MType<type>, order> Rows_() const {
         static_assert(
             first_row < last_row,
             "Take the successive rows by index requires 'The first index should be smaller than the last index'.");
@@ -5760,6 +6990,64 @@ class Mat {
         return *this;
     }
 
+    /**
+     * @brief Take a block (submatrix) at a compile-time offset as a read only view.
+     *
+     * @tparam row_ The row index of the first element of the block.
+     * @tparam col_ The column index of the first element of the block.
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @return (BlockView<rows_, cols_, MatOffset<row_, col_>>) The read only block view.
+     */
+    template <size_t row_, size_t col_, size_t rows_, size_t cols_>
+    BlockView<rows_, cols_, MatOffset<row_, col_>> block_() const {
+        return MatView<T, n_rows, n_cols, type, order>(_data);
+    }
+
+    /**
+     * @brief Take a block (submatrix) at a compile-time offset as a writable view.
+     *
+     * @details The block should be fully stored in the matrix (e.g. within the upper triangle of an UPPER matrix).
+     * @tparam row_ The row index of the first element of the block.
+     * @tparam col_ The column index of the first element of the block.
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @return (BlockRef<rows_, cols_, MatOffset<row_, col_>>) The writable block view.
+     */
+    template <size_t row_, size_t col_, size_t rows_, size_t cols_>
+    BlockRef<rows_, cols_, MatOffset<row_, col_>> block_() {
+        return MatRef<T, n_rows, n_cols, type, order>(_data);
+    }
+
+    /**
+     * @brief Take a block (submatrix) at a runtime offset as a read only view.
+     *
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @param row The row index of the first element of the block.
+     * @param col The column index of the first element of the block.
+     * @return (BlockView<rows_, cols_>) The read only block view.
+     */
+    template <size_t rows_, size_t cols_>
+    BlockView<rows_, cols_> block_(size_t row, size_t col) const {
+        return { MatView<T, n_rows, n_cols, type, order>(_data), row, col };
+    }
+
+    /**
+     * @brief Take a block (submatrix) at a runtime offset as a writable view.
+     *
+     * @details The block should be fully stored in the matrix (e.g. within the upper triangle of an UPPER matrix).
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @param row The row index of the first element of the block.
+     * @param col The column index of the first element of the block.
+     * @return (BlockRef<rows_, cols_>) The writable block view.
+     */
+    template <size_t rows_, size_t cols_>
+    BlockRef<rows_, cols_> block_(size_t row, size_t col) {
+        return { MatRef<T, n_rows, n_cols, type, order>(_data), row, col };
+    }
+
     /**
      * @brief Take discrete rows of a matrix by container.
      *
@@ -5784,10 +7072,10 @@ class Mat {
         static_assert(n_cols == cols_, "The number of the Matrices' cols should meet.");
         for (size_t i = 0; i != n_rows; ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
-            assert(vector[i] > int(0) &&
+            assert(vector[i] >= int(0) &&
                    "Take the discrete n_rows by index requires 'The indexes can't be smaller than 0'.");
-            assert(vector[i] < n_rows && "Take the discrete n_rows by index requires 'The indexes should be smaller "
-                                         "than the number of the matrix's rows.'.");
+            assert(vector[i] < rows_ && "Take the discrete n_rows by index requires 'The indexes should be smaller "
+                                        "than the number of the matrix's rows.'.");
             for (size_t j = 0; j != n_cols; ++j) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
                 (*this)(i, j) = mat(vector[i], j);
@@ -5858,8 +7146,8 @@ class Mat {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
             assert(vector[j] >= int(0) &&
                    "Take the discrete n_cols by index requires 'The indexes can't be smaller than 0'.");
-            assert(vector[j] < n_cols && "Take the discrete n_cols by index requires 'The indexes should be smaller "
-                                         "than the number of the matrix's cols.'.");
+            assert(vector[j] < cols_ && "Take the discrete n_cols by index requires 'The indexes should be smaller "
+                                        "than the number of the matrix's cols.'.");
             for (size_t i = 0; i != n_rows; ++i) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
                 (*this)(i, j) = mat(i, vector[j]);
@@ -5896,7 +7184,7 @@ class Mat {
                    "Take the discrete n_cols by index requires 'The indexes can't be smaller than 0'.");
             assert(vector[j] < n_cols && "Take the discrete n_cols by index requires 'The indexes should be smaller "
                                          "than the number of the matrix's cols.'.");
-            for (size_t i = 0; i != n_cols; ++i) {
+            for (size_t i = 0; i != n_rows; ++i) {
                 FLAMES_PRAGMA(LOOP_FLATTEN)
                 mat(i, j) = (*this)(i, vector[j]);
             }
@@ -5943,7 +7231,7 @@ class Mat {
                 FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_TRANSPOSE_UNROLL_FACTOR)
                 for (size_t j = 0; j != n_rows; ++j) {
                     FLAMES_PRAGMA(LOOP_FLATTEN)
-                    _data[n_rows * i + j] = mat._data[n_rows * j + i];
+                    (*this)(j, i) = mat(i, j);
                 }
             }
         } else if (type == MatType::UPPER) {
@@ -6205,11 +7493,61 @@ class Mat {
     /**
      * @brief Transpose as a read only view.
      *
-     * @return (MatViewT<T, n_cols, n_rows, tType(type)>) The read only view transpose.
+     * @return (TView) The read only view transpose.
+     */
+    TView t_() { return rawDataPtr(); }
+
+    TView t_() const { return const_cast<T*>(rawDataPtr()); }
+
+    /**
+     * @brief Reshape as a read only view.
+     *
+     * @details The data array is reinterpreted in the storage order,
+     *          i.e. a row major matrix is reshaped row by row and a column major one column by column.
+     * @tparam rows_ The row number of the reshaped matrix.
+     * @tparam cols_ The column number of the reshaped matrix.
+     * @return (MatView<T, rows_, cols_, MatType::NORMAL, order>) The read only reshaped view.
+     */
+    template <size_t rows_, size_t cols_>
+    MatView<T, rows_, cols_, MatType::NORMAL, order> reshape_() const {
+        static_assert(type == MatType::NORMAL, "Only a NORMAL matrix can be reshaped.");
+        static_assert(rows_ * cols_ == n_rows * n_cols, "Reshape should keep the number of elements.");
+        return rawDataPtr();
+    }
+
+    /**
+     * @brief Reshape as a writable view.
+     *
+     * @details The data array is reinterpreted in the storage order,
+     *          i.e. a row major matrix is reshaped row by row and a column major one column by column.
+     * @tparam rows_ The row number of the reshaped matrix.
+     * @tparam cols_ The column number of the reshaped matrix.
+     * @return (MatRef<T, rows_, cols_, MatType::NORMAL, order>) The writable reshaped view.
+     */
+    template <size_t rows_, size_t cols_>
+    MatRef<T, rows_, cols_, MatType::NORMAL, order> reshape_() {
+        static_assert(type == MatType::NORMAL, "Only a NORMAL matrix can be reshaped.");
+        static_assert(rows_ * cols_ == n_rows * n_cols, "Reshape should keep the number of elements.");
+        return rawDataPtr();
+    }
+
+    /**
+     * @brief Vectorize as a read only view.
+     *
+     * @details The elements are stacked in the storage order,
+     *          so this is vec(A) (columns stacked) for a column major matrix
+     *          and the row major vectorization vec(A^T) (rows stacked, as used by `MatKron`) for a row major one.
+     * @return (MatView<T, n_rows * n_cols, 1>) The read only column vector view.
      */
-    MatViewT<T, n_cols, n_rows, tType(type)> t_() { return const_cast<T*>(_data); }
+    MatView<T, n_rows * n_cols, 1> vec_() const { return reshape_<n_rows * n_cols, 1>()._data; }
 
-    MatViewT<T, n_cols, n_rows, tType(type)> t_() const { return const_cast<T*>(_data); }
+    /**
+     * @brief Vectorize as a writable view.
+     *
+     * @details The elements are stacked in the storage order (see the read only version).
+     * @return (MatRef<T, n_rows * n_cols, 1>) The writable column vector view.
+     */
+    MatRef<T, n_rows * n_cols, 1> vec_() { return reshape_<n_rows * n_cols, 1>()._data; }
 
     /**
      * @brief In-place transpose.
@@ -6263,7 +7601,7 @@ class Mat {
     MAT_OPP:
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
-            _data[i] = -mat[i];
+            _data[i] = -_at(mat, i);
         }
         return *this;
     }
@@ -6295,9 +7633,9 @@ class Mat {
     /**
      * @brief Matrix opposite as a read only view.
      *
-     * @return (MatViewOpp<T, n_rows, n_cols, type>) The read only view opposite.
+     * @return (MatViewOpp<T, n_rows, n_cols, type, order>) The read only view opposite.
      */
-    MatViewOpp<T, n_rows, n_cols, type> opp_() const {
+    MatViewOpp<T, n_rows, n_cols, type, order> opp_() const {
         FLAMES_PRAGMA(INLINE)
         return *this;
     }
@@ -6369,9 +7707,10 @@ class Mat {
     /**
      * @brief Take the diagonal of a matrix as a read only view.
      *
-     * @return (MatViewDiagMat<T, n_rows, n_cols, MatType::DIAGONAL, MType<type>>) The read only diagonal matrix view.
+     * @return (MatViewDiagMat<T, n_rows, n_cols, MatType::DIAGONAL, MType<type>, order>) The read only
+     * diagonal matrix view.
      */
-    MatViewDiagMat<T, n_rows, n_cols, MatType::DIAGONAL, MType<type>> diagMat_() const {
+    MatViewDiagMat<T, n_rows, n_cols, MatType::DIAGONAL, MType<type>, order> diagMat_() const {
         static_assert(n_rows == n_cols, "Take the diagonal requires 'n_rows == n_cols'.");
         return *this;
     }
@@ -6427,9 +7766,21 @@ class Mat {
     /**
      * @brief Take the diagonal vector of a matrix as a read only view.
      *
-     * @return (MatViewDiagVec<T, n_rows, n_cols, MatType::DIAGONAL, MType<type>>) The read only diagonal vector view.
+     * @return (MatViewDiagVec<T, n_rows, 1, MatType::NORMAL, MType<type>, order>) The read only diagonal vector view.
+     */
+    MatViewDiagVec<T, n_rows, 1, MatType::NORMAL, MType<type>, order> diagVec_() const {
+        static_assert(n_rows == n_cols, "Take the diagonal requires 'n_rows == n_cols'.");
+        return *this;
+    }
+
+    /**
+     * @brief Take the diagonal vector of a matrix as a writable view.
+     *
+     * @details Only the n diagonal entries are accessed,
+     *          e.g. `A.diagRef_() = d` sets the diagonal without touching the other entries.
+     * @return (MatRefDiag<T, n_rows, 1, MatType::NORMAL, MType<type>, order>) The writable diagonal vector view.
      */
-    MatViewDiagVec<T, n_rows, 1, MatType::NORMAL, MType<type>> diagVec_() const {
+    MatRefDiag<T, n_rows, 1, MatType::NORMAL, MType<type>, order> diagRef_() {
         static_assert(n_rows == n_cols, "Take the diagonal requires 'n_rows == n_cols'.");
         return *this;
     }
@@ -6485,9 +7836,10 @@ class Mat {
     /**
      * @brief Take the diagonal row vector of a matrix as a read only view.
      *
-     * @return (MatViewDiagRowVec<T, 1, n_cols, MatType::NORMAL, MType<type>> ) The read only diagonal row vector view.
+     * @return (MatViewDiagRowVec<T, 1, n_cols, MatType::NORMAL, MType<type>, order>) The read only
+     * diagonal row vector view.
      */
-    MatViewDiagRowVec<T, 1, n_cols, MatType::NORMAL, MType<type>> diagRowVec_() const {
+    MatViewDiagRowVec<T, 1, n_cols, MatType::NORMAL, MType<type>, order> diagRowVec_() const {
         static_assert(n_rows == n_cols, "Take the diagonal requires 'n_rows == n_cols'.");
         return *this;
     }
@@ -6553,9 +7905,10 @@ class Mat {
     /**
      * @brief Take the diagonal of a matrix as a read only view.
      *
-     * @return (MatViewOffDiag<T, n_rows, n_cols, MatType::NORMAL, MType<type>>) The read only off diagonal matrix view.
+     * @return (MatViewOffDiag<T, n_rows, n_cols, MatType::NORMAL, MType<type>, order>) The read only
+     * off diagonal matrix view.
      */
-    MatViewOffDiag<T, n_rows, n_cols, MatType::NORMAL, MType<type>> offDiag_() const {
+    MatViewOffDiag<T, n_rows, n_cols, MatType::NORMAL, MType<type>, order> offDiag_() const {
         static_assert(n_rows == n_cols, "Take the off diagonal requires 'n_rows == n_cols'.");
         return *this;
     }
@@ -6582,7 +7935,7 @@ class Mat {
         static_assert(type == MatType::DIAGONAL, "'invDiag' is only used for diagonal matrix.");
         for (size_t i = 0; i != n_rows; ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
-            _data[i] = T(1.0) / mat(i, i);
+            _data[i] = _Op::div(T(1.0), mat(i, i));
         }
         return *this;
     }
@@ -6598,63 +7951,216 @@ class Mat {
         Mat mat;
         for (size_t i = 0; i != n_rows; ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_INV_UNROLL_FACTOR)
-            mat._data[i] = T(1.0) / _data[i];
+            mat._data[i] = _Op::div(T(1.0), _data[i]);
         }
+        return mat;
     }
 
     /**
-     * @brief Matrix inverse using Newton-Schulz iterative method (NSA).
+     * @brief Add a value to the diagonal in place, i.e. A + λI.
      *
-     * @tparam M The original matrix type.
-     * @tparam _unused (unused)
-     * @tparam T2 The original matrix element type.
-     * @tparam type2 The original matrix MatType.
-     * @param mat The original matrix.
-     * @param iter The number of iterations (default as 4).
-     * @return (Mat&) The inverse matrix (a reference to 'this').
-     */
-    template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T2,
-              MatType type2>
-    Mat& invNSA(const M<T2, n_rows, n_cols, type2, _unused...>& mat, size_t iter = 4) {
-        static_assert(n_rows == n_cols, "Calculate inverse needs to be a square matrix.");
-        assert(iter >= 1 && "At least one iteration is needed.");
-        const auto D = mat.diagMat_(); // diagonal part
-        const auto E = mat.offDiag_(); // off-diagonal part
-        Mat<T, n_rows, n_cols, MatType::DIAGONAL> D_inv;
-        D_inv.invDiag(D); // inverse of diagonal part
-        // D_inv.print("D_inv:\n");
-        // E.asMat().print("E:\n");
-        auto D_inv_opp                                  = -D_inv;
-        Mat<T, n_rows, n_cols, MatType::NORMAL> product = D_inv_opp * E;
-        Mat<T, n_rows, n_cols, MatType::NORMAL> sum_tmp = *this = product; // the first iteration
-        Mat<T, n_rows, n_cols, MatType::NORMAL> tmp;
-    MAT_INV_NSA:
-        for (size_t i = 1; i < iter; ++i) {
-            tmp.mul(*this, product);
-            *this = tmp;
-            sum_tmp += tmp;
+     * @details Only the n diagonal entries (or the single entry of a SCALAR matrix) are updated,
+     *          e.g. for the regularization of MMSE detection.
+     *          You may configure macro
+     *          `FLAMES_MAT_PLUS_UNROLL_FACTOR` or
+     *          `FLAMES_UNROLL_FACTOR` to do the operation in parallel.
+     * @param val The value λ.
+     * @return (Mat&) The result (a reference to 'this').
+     */
+    Mat& addDiag(T val) {
+        static_assert(n_rows == n_cols, "Adding to the diagonal requires 'n_rows == n_cols'.");
+        static_assert(type != MatType::SUPPER && type != MatType::SLOWER && type != MatType::ASYM,
+                      "The diagonal of this matrix is not stored.");
+        if (type == MatType::SCALAR) {
+            _data[0] = _Op::add(_data[0], val);
+        } else {
+        MAT_ADD_DIAG:
+            for (size_t i = 0; i != n_rows; ++i) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
+                (*this)(i, i) = _Op::add((*this)(i, i), val);
+            }
         }
-        this->mul(sum_tmp, D_inv);
-        return *this += D_inv;
+        return *this;
     }
 
     /**
-     * @brief Matrix inverse using Newton-Schulz iterative method (NSA) as a copy.
+     * @brief Scale the rows in place, i.e. diag(vec) * A.
      *
-     * @note This function makes a copy,
-     *       so if you want to optimize your design,
-     *       always use .invNSA(Mat) that takes an argument to avoid copy in place other than initialization.
-     *       They are equivalent in initialization.
-     * @param iter The number of iterations (default as 4).
-     * @return (Mat) The inverse matrix copy.
+     * @details Row r is multiplied by vec(r, 0) in a single pass over the stored elements.
+     *          You may configure macro
+     *          `FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR` or
+     *          `FLAMES_UNROLL_FACTOR` to do the operation in parallel.
+     * @tparam M The vector type.
+     * @tparam _unused (unused)
+     * @tparam T2 The vector element type.
+     * @tparam type2 The vector MatType.
+     * @param vec The (column) vector of row scales.
+     * @return (Mat&) The result (a reference to 'this').
      */
-    Mat invNSA(size_t iter = 4) const {
-        static_assert(n_rows == n_cols, "Calculate inverse needs to be a square matrix.");
-        Mat mat;
-        mat.invNSA(*this, iter);
-        return mat;
-    }
-
+    template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T2,
+              MatType type2>
+    Mat& scaleRows(const M<T2, n_rows, 1, type2, _unused...>& vec) {
+        static_assert(type != MatType::SCALAR && type != MatType::SYM && type != MatType::ASYM,
+                      "Scaling the rows does not keep the MatType of this matrix.");
+        if (type == MatType::NORMAL) {
+        MAT_SCALE_ROWS_NORMAL:
+            for (size_t i = 0; i != size(); ++i) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
+                _data[i] = _Op::mul(_data[i], vec(isColMajor() ? i % n_rows : i / n_cols, 0));
+            }
+        } else if (type == MatType::DIAGONAL) {
+        MAT_SCALE_ROWS_DIAGONAL:
+            for (size_t i = 0; i != n_rows; ++i) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
+                _data[i] = _Op::mul(_data[i], vec(i, 0));
+            }
+        } else {
+        MAT_SCALE_ROWS:
+            for (size_t r = 0; r != n_rows; ++r) {
+                for (size_t c = 0; c != n_cols; ++c) {
+                    FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
+                    FLAMES_PRAGMA(LOOP_FLATTEN)
+                    if (_blockStored(type, r, c, 1, 1)) (*this)(r, c) = _Op::mul((*this)(r, c), vec(r, 0));
+                }
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Scale the columns in place, i.e. A * diag(vec).
+     *
+     * @details Column c is multiplied by vec(c, 0) in a single pass over the stored elements.
+     *          You may configure macro
+     *          `FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR` or
+     *          `FLAMES_UNROLL_FACTOR` to do the operation in parallel.
+     * @tparam M The vector type.
+     * @tparam _unused (unused)
+     * @tparam T2 The vector element type.
+     * @tparam type2 The vector MatType.
+     * @param vec The (column) vector of column scales.
+     * @return (Mat&) The result (a reference to 'this').
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T2,
+              MatType type2>
+    Mat& scaleCols(const M<T2, n_cols, 1, type2, _unused...>& vec) {
+        static_assert(type != MatType::SCALAR && type != MatType::SYM && type != MatType::ASYM,
+                      "Scaling the columns does not keep the MatType of this matrix.");
+        if (type == MatType::NORMAL) {
+        MAT_SCALE_COLS_NORMAL:
+            for (size_t i = 0; i != size(); ++i) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
+                _data[i] = _Op::mul(_data[i], vec(isColMajor() ? i / n_rows : i % n_cols, 0));
+            }
+        } else if (type == MatType::DIAGONAL) {
+        MAT_SCALE_COLS_DIAGONAL:
+            for (size_t i = 0; i != n_cols; ++i) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
+                _data[i] = _Op::mul(_data[i], vec(i, 0));
+            }
+        } else {
+        MAT_SCALE_COLS:
+            for (size_t r = 0; r != n_rows; ++r) {
+                for (size_t c = 0; c != n_cols; ++c) {
+                    FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
+                    FLAMES_PRAGMA(LOOP_FLATTEN)
+                    if (_blockStored(type, r, c, 1, 1)) (*this)(r, c) = _Op::mul((*this)(r, c), vec(c, 0));
+                }
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief The workspace size (in elements) needed by `invNSA`.
+     *
+     * @return (constexpr size_t) The workspace size.
+     */
+    inline static constexpr size_t invNSAWorkspaceSize() noexcept { return n_rows + 2 * n_rows * n_cols; }
+
+    /**
+     * @brief Matrix inverse using Newton-Schulz iterative method (NSA) with a workspace.
+     *
+     * @details With A = D + E (the diagonal and off-diagonal parts) and P = -D^(-1) E,
+     *          the inverse is approximated by (I + P + ... + P^iter) D^(-1),
+     *          where the sum is evaluated in Horner form, i.e. X = P + P X.
+     *          The temporaries (D^(-1), P and one product) are carved out of the workspace,
+     *          which should hold at least `invNSAWorkspaceSize()` elements.
+     * @tparam M The original matrix type.
+     * @tparam _unused (unused)
+     * @tparam T2 The original matrix element type.
+     * @tparam type2 The original matrix MatType.
+     * @tparam ws_size The workspace size.
+     * @tparam ws_policy The workspace storage policy.
+     * @param mat The original matrix.
+     * @param ws The workspace.
+     * @param iter The number of iterations (default as 4).
+     * @return (Mat&) The inverse matrix (a reference to 'this').
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T2,
+              MatType type2, size_t ws_size, typename ws_policy>
+    Mat& invNSA(const M<T2, n_rows, n_cols, type2, _unused...>& mat, MatWorkspace<T, ws_size, ws_policy>& ws,
+                size_t iter = 4) {
+        static_assert(n_rows == n_cols, "Calculate inverse needs to be a square matrix.");
+        static_assert(ws_size >= invNSAWorkspaceSize(), "The workspace is too small for 'invNSA'.");
+        assert(iter >= 1 && "At least one iteration is needed.");
+        auto D_inv   = ws.template get<0, n_rows, n_cols, MatType::DIAGONAL>(); // inverse of diagonal part
+        auto product = ws.template get<n_rows, n_rows, n_cols>();               // P = -D_inv * E
+        auto tmp     = ws.template get<n_rows + n_rows * n_cols, n_rows, n_cols>();
+    MAT_INV_NSA_INIT:
+        for (size_t r = 0; r != n_rows; ++r) {
+            D_inv(r, r) = _Op::div(T(1.0), mat(r, r));
+            for (size_t c = 0; c != n_cols; ++c) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_INV_UNROLL_FACTOR)
+                product(r, c) = r == c ? T(0) : T(-_Op::mul(D_inv(r, r), mat(r, c)));
+                (*this)(r, c) = product(r, c); // the first iteration
+            }
+        }
+    MAT_INV_NSA:
+        for (size_t i = 1; i < iter; ++i) {
+            tmp.mul(product, *this);
+            this->add(tmp, product);
+        }
+        // (I + X) * D_inv, where the diagonal data of D_inv is a vector
+        return this->addDiag(T(1.0)).scaleCols(MatView<T, n_rows, 1>(D_inv._data));
+    }
+
+    /**
+     * @brief Matrix inverse using Newton-Schulz iterative method (NSA).
+     *
+     * @details A local workspace is used. See the overload with a workspace.
+     * @tparam M The original matrix type.
+     * @tparam _unused (unused)
+     * @tparam T2 The original matrix element type.
+     * @tparam type2 The original matrix MatType.
+     * @param mat The original matrix.
+     * @param iter The number of iterations (default as 4).
+     * @return (Mat&) The inverse matrix (a reference to 'this').
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T2,
+              MatType type2>
+    Mat& invNSA(const M<T2, n_rows, n_cols, type2, _unused...>& mat, size_t iter = 4) {
+        MatWorkspace<T, invNSAWorkspaceSize()> ws;
+        return invNSA(mat, ws, iter);
+    }
+
+    /**
+     * @brief Matrix inverse using Newton-Schulz iterative method (NSA) as a copy.
+     *
+     * @note This function makes a copy,
+     *       so if you want to optimize your design,
+     *       always use .invNSA(Mat) that takes an argument to avoid copy in place other than initialization.
+     *       They are equivalent in initialization.
+     * @param iter The number of iterations (default as 4).
+     * @return (Mat) The inverse matrix copy.
+     */
+    Mat invNSA(size_t iter = 4) const {
+        static_assert(n_rows == n_cols, "Calculate inverse needs to be a square matrix.");
+        Mat mat;
+        mat.invNSA(*this, iter);
+        return mat;
+    }
+
     /**
      * @brief Matrix inverse using improved Newton-Schulz iterative method (INSA).
      *
@@ -6749,9 +8255,9 @@ class Mat {
     /**
      * @brief The unary plus operator.
      *
-     * @return (MatView<T, n_rows, n_cols, type>) Return the MatView of the matrix.
+     * @return (MatView<T, n_rows, n_cols, type, order>) Return the MatView of the matrix.
      */
-    MatView<T, n_rows, n_cols, type> operator+() const {
+    MatView<T, n_rows, n_cols, type, order> operator+() const {
         FLAMES_PRAGMA(INLINE)
         return *this;
     }
@@ -6760,9 +8266,9 @@ class Mat {
      * @brief The unary minus operator.
      *
      * @details This is the same as .opp_().
-     * @return (MatViewOpp<T, n_rows, n_cols, type>) The read only opposite matrix view.
+     * @return (MatViewOpp<T, n_rows, n_cols, type, order>) The read only opposite matrix view.
      */
-    MatViewOpp<T, n_rows, n_cols, type> operator-() const {
+    MatViewOpp<T, n_rows, n_cols, type, order> operator-() const {
         FLAMES_PRAGMA(INLINE)
         return *this;
     }
@@ -6780,6 +8286,96 @@ class Mat {
 
     const T* rawDataPtr() const { return _data; }
 
+    /// The arithmetic operators bound by the operator policy `MatOp` of the element type.
+    using _Op = _OpBind<MatOp<T>>;
+
+    /**
+     * @brief The data array index of an element given by its row major index.
+     *
+     * @details Only NORMAL matrices are reordered, since the other supported MatTypes
+     *          are initialized from row major data only when both orders are stored alike.
+     * @param index The row major index.
+     * @return (constexpr size_t) The data array index.
+     */
+    inline static constexpr size_t _storageIndex(size_t index) noexcept {
+        return isColMajor() && type == MatType::NORMAL ? index % n_cols * n_rows + index / n_cols : index;
+    }
+
+    /**
+     * @brief Read the element of a matrix at a data array index of 'this'.
+     *
+     * @details A matrix of the same storage order is read on its data array,
+     *          otherwise the index is mapped to the row and column of the element first.
+     * @tparam M The matrix type.
+     * @param mat The matrix, of the same dimensions and MatType as 'this'.
+     * @param index The data array index of 'this'.
+     * @return (auto) The element.
+     */
+    template <typename M>
+    inline static auto _at(const M& mat, size_t index) -> std::decay_t<decltype(mat(0, 0))> {
+        FLAMES_PRAGMA(INLINE)
+        if (sameOrder<Mat, M>(type)) return mat[index];
+        // row and column in the stored matrix, which is the transpose if column major
+        constexpr MatType s_type = isColMajor() ? tType(type) : type;
+        constexpr size_t s_cols = isColMajor() ? n_rows : n_cols;
+        size_t r = 0, c = 0;
+        if (s_type == MatType::NORMAL) {
+            r = index / s_cols;
+            c = index % s_cols;
+        } else if (s_type == MatType::DIAGONAL) {
+            r = c = index;
+        } else if (s_type == MatType::UPPER || s_type == MatType::SYM) {
+            r = upperRow(index, s_cols);
+            c = r + index - (2 * s_cols + 1 - r) * r / 2;
+        } else if (s_type == MatType::LOWER) {
+            r = lowerRow(index, s_cols);
+            c = index - (1 + r) * r / 2;
+        } else if (s_type == MatType::SUPPER || s_type == MatType::ASYM) {
+            r = supperRow(index, s_cols);
+            c = 2 * r + 1 + index - (2 * s_cols + 1 - r) * r / 2;
+        } else if (s_type == MatType::SLOWER) {
+            r = slowerRow(index, s_cols);
+            c = index - (1 + r) * r / 2 + r;
+        }
+        return isColMajor() ? mat(c, r) : mat(r, c);
+    }
+
+    inline ColView _col_(size_t index, std::true_type) const { return _data + index * n_rows; }
+
+    inline ColView _col_(size_t index, std::false_type) const { return { *this, index }; }
+
+    inline ColRef _col_(size_t index, std::true_type) { return _data + index * n_rows; }
+
+    inline ColRef _col_(size_t index, std::false_type) { return { *this, index }; }
+
+    /**
+     * @brief Assign the i-th element of a stream in a given order.
+     *
+     * @param i The element index in the stream.
+     * @param value The value to be assigned.
+     * @param s_order The element order in the stream.
+     */
+    inline void _streamSet(size_t i, T value, MatStreamOrder s_order) {
+        FLAMES_PRAGMA(INLINE)
+        if (s_order == MatStreamOrder::PACKED) _data[i] = value;
+        else if (s_order == MatStreamOrder::COL) _tryAssign(i % n_rows, i / n_rows, value);
+        else _tryAssign(i / n_cols, i % n_cols, value);
+    }
+
+    /**
+     * @brief Get the i-th element of a stream in a given order.
+     *
+     * @param i The element index in the stream.
+     * @param s_order The element order in the stream.
+     * @return (T) The element value.
+     */
+    inline T _streamGet(size_t i, MatStreamOrder s_order) const {
+        FLAMES_PRAGMA(INLINE)
+        if (s_order == MatStreamOrder::PACKED) return _data[i];
+        else if (s_order == MatStreamOrder::COL) return (*this)(i % n_rows, i / n_rows);
+        else return (*this)(i / n_cols, i % n_cols);
+    }
+
     /**
      * @brief Try to assign a value to a specific position.
      *
@@ -7037,32 +8633,38 @@ class Mat {
 
   public: // original private
     /**
-     * @brief The raw data array in row major.
+     * @brief The raw data array in the storage order (row major by default).
      *
-     * @details You can set the array partition using macro
-     *          `FLAMES_MAT_PARTITION_COMPLETE` to set a complete array partition
-     *          and `FLAMES_MAT_PARTITION_FACTOR` to set a block partition with the specific factor.
+     * @details The array partition and storage binding follow the storage policy `MatStorage`,
+     *          which is set by macros `FLAMES_MAT_PARTITION_COMPLETE` and `FLAMES_MAT_PARTITION_FACTOR` by default.
      *
      */
-    T _data[type == MatType::NORMAL     ? n_rows * n_cols
-            : type == MatType::DIAGONAL ? n_rows
-            : type == MatType::SCALAR   ? 1
-            : type == MatType::SUPPER   ? (n_rows - 1) * n_rows / 2
-            : type == MatType::SLOWER   ? (n_rows - 1) * n_rows / 2
-            : type == MatType::ASYM     ? (n_rows - 1) * n_rows / 2
-                                        : (1 + n_rows) * n_rows / 2];
+    _StorageArray<T,
+                  type == MatType::NORMAL     ? n_rows * n_cols
+                  : type == MatType::DIAGONAL ? n_rows
+                  : type == MatType::SCALAR   ? 1
+                  : type == MatType::SUPPER   ? (n_rows - 1) * n_rows / 2
+                  : type == MatType::SLOWER   ? (n_rows - 1) * n_rows / 2
+                  : type == MatType::ASYM     ? (n_rows - 1) * n_rows / 2
+                                              : (1 + n_rows) * n_rows / 2,
+                  MatStorage<T, n_rows, n_cols, type, order>>
+        _data;
 };
 
-template <typename T, size_t n_rows, size_t n_cols, MatType type>
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename order>
 class MatView {
   public:
+    /// Read only block view (of rows_ x cols_ at `offset_`).
+    template <size_t rows_, size_t cols_, typename offset_ = MATOFFSET_DYNAMIC>
+    using BlockView = MatViewBlock<T, rows_, cols_, MatType::NORMAL, MatView, offset_>;
+
     /**
      * @brief Construct a new MatView object from raw data pointer.
      *
      * @param m The original matrix.
      */
-    MatView(const Mat<T, n_rows, n_cols, type>& m) : _data(m.rawDataPtr()) {}
-    MatView(Mat<T, n_rows, n_cols, type>& m) : _data(m.rawDataPtr()) {}
+    MatView(const Mat<T, n_rows, n_cols, type, order>& m) : _data(m.rawDataPtr()) {}
+    MatView(Mat<T, n_rows, n_cols, type, order>& m) : _data(m.rawDataPtr()) {}
 
     MatView(const T* const ptr) : _data(ptr) {}
 
@@ -7088,7 +8690,16 @@ class MatView {
                                            : (1 + n_rows) * n_rows / 2;
     }
 
-    MatView& operator=(const Mat<T, n_rows, n_cols, type>& m) {
+    /**
+     * @brief Get the storage order of the viewed data array.
+     *
+     * @return (constexpr MatOrder) The storage order.
+     */
+    inline static constexpr MatOrder storageOrder() noexcept { return order::value; }
+
+    inline static constexpr bool isColMajor() noexcept { return order::value == MatOrder::COL_MAJOR; }
+
+    MatView& operator=(const Mat<T, n_rows, n_cols, type, order>& m) {
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
             _data[i] = m[i];
@@ -7115,7 +8726,11 @@ class MatView {
         FLAMES_PRAGMA(INLINE)
         assert(r < n_rows && "Matrix row index should be within range");
         assert(c < n_cols && "Matrix col index should be within range");
-        if (type == MatType::NORMAL) {
+        static_assert(!isColMajor() || type != MatType::ASYM, "Column major ASYM matrices are not supported.");
+        if (isColMajor()) {
+            // column major storage is the row major storage of the transpose
+            return MatView<T, n_cols, n_rows, tType(type)>(_data)(c, r);
+        } else if (type == MatType::NORMAL) {
             return _data[r * n_cols + c];
         } else if (type == MatType::DIAGONAL) {
             if (r == c) return _data[r];
@@ -7133,7 +8748,7 @@ class MatView {
             if (r < c) return _data[(2 * n_cols + 1 - r) * r / 2 + c - 2 * r - 1];
             else return T(0);
         } else if (type == MatType::SLOWER) {
-            if (r >= c) return _data[(1 + r) * r / 2 + c - r];
+            if (r > c) return _data[(1 + r) * r / 2 + c - r];
             else return T(0);
         } else if (type == MatType::SYM) {
             if (r <= c) return _data[(2 * n_cols + 1 - r) * r / 2 + c - r];
@@ -7249,7 +8864,39 @@ class MatView {
         return *this;
     }
 
-    MatViewT<T, n_cols, n_rows, type> t_() const { return _data; }
+    std::conditional_t<order::value == MatOrder::COL_MAJOR, MatView<T, n_cols, n_rows, tType(type)>,
+                       MatViewT<T, n_cols, n_rows, type>>
+    t_() const {
+        return const_cast<T*>(_data);
+    }
+
+    /**
+     * @brief Take a block (submatrix) at a compile-time offset as a read only view.
+     *
+     * @tparam row_ The row index of the first element of the block.
+     * @tparam col_ The column index of the first element of the block.
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @return (BlockView<rows_, cols_, MatOffset<row_, col_>>) The read only block view.
+     */
+    template <size_t row_, size_t col_, size_t rows_, size_t cols_>
+    BlockView<rows_, cols_, MatOffset<row_, col_>> block_() const {
+        return *this;
+    }
+
+    /**
+     * @brief Take a block (submatrix) at a runtime offset as a read only view.
+     *
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @param row The row index of the first element of the block.
+     * @param col The column index of the first element of the block.
+     * @return (BlockView<rows_, cols_>) The read only block view.
+     */
+    template <size_t rows_, size_t cols_>
+    BlockView<rows_, cols_> block_(size_t row, size_t col) const {
+        return { *this, row, col };
+    }
 
     template <typename Tp = T>
     Tp power() const {
@@ -7275,21 +8922,21 @@ class MatView {
     /**
      * @brief Conversion from view to a real Mat.
      *
-     * @return (Mat<T, n_rows, n_cols, type>) The real Mat.
+     * @return (Mat<T, n_rows, n_cols, type, order>) The real Mat.
      */
-    operator Mat<T, n_rows, n_cols, type>() const {
+    operator Mat<T, n_rows, n_cols, type, order>() const {
         FLAMES_PRAGMA(INLINE);
-        return Mat<T, n_rows, n_cols, type>(const_cast<const T*>(_data), InitAfterwards::NONE);
+        return Mat<T, n_rows, n_cols, type, order>(const_cast<const T*>(_data), InitAfterwards::NONE);
     }
 
     /**
      * @brief Explicitly make a Mat copy.
      *
-     * @return (Mat<T, n_rows, n_cols, type>) The real Mat.
+     * @return (Mat<T, n_rows, n_cols, type, order>) The real Mat.
      */
-    Mat<T, n_rows, n_cols, type> asMat() const {
+    Mat<T, n_rows, n_cols, type, order> asMat() const {
         FLAMES_PRAGMA(INLINE);
-        return static_cast<Mat<T, n_rows, n_cols, type>>(*this);
+        return static_cast<Mat<T, n_rows, n_cols, type, order>>(*this);
     }
 
     void print(const std::string& str = "", std::ostream& os = std::cout) const { this->asMat().print(str, os); }
@@ -7299,17 +8946,24 @@ class MatView {
     const T* const _data;
 };
 
-template <typename T, size_t n_rows, size_t n_cols, MatType type>
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename order>
 class MatRef {
   public:
+    /// Read only block view (of rows_ x cols_ at `offset_`).
+    template <size_t rows_, size_t cols_, typename offset_ = MATOFFSET_DYNAMIC>
+    using BlockView = MatViewBlock<T, rows_, cols_, MatType::NORMAL, MatView<T, n_rows, n_cols, type, order>, offset_>;
+    /// Writable block view (of rows_ x cols_ at `offset_`).
+    template <size_t rows_, size_t cols_, typename offset_ = MATOFFSET_DYNAMIC>
+    using BlockRef = MatRefBlock<T, rows_, cols_, MatType::NORMAL, MatRef, offset_>;
+
     /**
      * @brief Construct a new MatView object from raw data pointer.
      *
      * @param m The original matrix.
      */
-    MatRef(Mat<T, n_rows, n_cols, type>& m) : _data(m.rawDataPtr()) {}
+    MatRef(Mat<T, n_rows, n_cols, type, order>& m) : _data(m.rawDataPtr()) {}
 
-    MatRef(const T* const ptr) : _data(ptr) {}
+    MatRef(T* const ptr) : _data(ptr) {}
 
     /**
      * @brief Copy constructor.
@@ -7333,7 +8987,16 @@ class MatRef {
                                            : (1 + n_rows) * n_rows / 2;
     }
 
-    MatRef& operator=(const Mat<T, n_rows, n_cols, type>& m) {
+    /**
+     * @brief Get the storage order of the viewed data array.
+     *
+     * @return (constexpr MatOrder) The storage order.
+     */
+    inline static constexpr MatOrder storageOrder() noexcept { return order::value; }
+
+    inline static constexpr bool isColMajor() noexcept { return order::value == MatOrder::COL_MAJOR; }
+
+    MatRef& operator=(const Mat<T, n_rows, n_cols, type, order>& m) {
         for (size_t i = 0; i != size(); ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
             _data[i] = m[i];
@@ -7360,7 +9023,11 @@ class MatRef {
         FLAMES_PRAGMA(INLINE)
         assert(r < n_rows && "Matrix row index should be within range");
         assert(c < n_cols && "Matrix col index should be within range");
-        if (type == MatType::NORMAL) {
+        static_assert(!isColMajor() || type != MatType::ASYM, "Column major ASYM matrices are not supported.");
+        if (isColMajor()) {
+            // column major storage is the row major storage of the transpose
+            return MatView<T, n_cols, n_rows, tType(type)>(_data)(c, r);
+        } else if (type == MatType::NORMAL) {
             return _data[r * n_cols + c];
         } else if (type == MatType::DIAGONAL) {
             if (r == c) return _data[r];
@@ -7378,7 +9045,7 @@ class MatRef {
             if (r < c) return _data[(2 * n_cols + 1 - r) * r / 2 + c - 2 * r - 1];
             else return T(0);
         } else if (type == MatType::SLOWER) {
-            if (r >= c) return _data[(1 + r) * r / 2 + c - r];
+            if (r > c) return _data[(1 + r) * r / 2 + c - r];
             else return T(0);
         } else if (type == MatType::SYM) {
             if (r <= c) return _data[(2 * n_cols + 1 - r) * r / 2 + c - r];
@@ -7405,7 +9072,11 @@ class MatRef {
         FLAMES_PRAGMA(INLINE)
         assert(r < n_rows && "Matrix row index should be within range");
         assert(c < n_cols && "Matrix col index should be within range");
-        if (type == MatType::NORMAL) {
+        static_assert(!isColMajor() || type != MatType::ASYM, "Column major ASYM matrices are not supported.");
+        if (isColMajor()) {
+            // column major storage is the row major storage of the transpose
+            return MatRef<T, n_cols, n_rows, tType(type)>(_data)(c, r);
+        } else if (type == MatType::NORMAL) {
             return _data[r * n_cols + c];
         } else if (type == MatType::DIAGONAL) {
             if (r == c) return _data[r];
@@ -7573,57 +9244,352 @@ class MatRef {
         return *this;
     }
 
-    MatViewT<T, n_cols, n_rows, type> t_() const { return _data; }
-
-    template <typename Tp = T>
-    Tp power() const {
-        Tp p = 0;
-        for (size_t i = 0; i != size(); ++i) {
-            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_POWER_UNROLL_FACTOR)
-            p += static_cast<Tp>(_data[i] * _data[i]);
-        }
-        return p;
-    }
-
-    template <typename Tp = T>
-    Tp abssum() const {
-        Tp p = 0;
-        for (size_t i = 0; i != size(); ++i) {
-            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_POWER_UNROLL_FACTOR)
-            auto d = _data[i];
-            if (d > 0) p += static_cast<Tp>(d);
+    /**
+     * @brief Matrix plus matrix into the referenced matrix.
+     *
+     * @details The result is stored to the referenced data, e.g. a scratch matrix of a MatWorkspace.
+     *          Matrices of the same MatType and storage order are processed on the data arrays,
+     *          otherwise the referenced matrix should be NORMAL and the result is computed entry by entry.
+     *          You may configure `FLAMES_MAT_PLUS_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing addition in parallel.
+     * @tparam M1 The left matrix type.
+     * @tparam _unused1 (unused)
+     * @tparam M2 The right matrix type.
+     * @tparam _unused2 (unused)
+     * @tparam T1 The left matrix element type.
+     * @tparam T2 The right matrix element type.
+     * @tparam type1 The left matrix MatType.
+     * @tparam type2 The right matrix MatType.
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (MatRef&) The addition result (a reference to 'this').
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+              template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+              typename T2, MatType type1, MatType type2>
+    MatRef& add(const M1<T1, n_rows, n_cols, type1, _unused1...>& mat_L,
+                const M2<T2, n_rows, n_cols, type2, _unused2...>& mat_R) {
+        constexpr bool flat = type1 == type && type2 == type &&
+                              sameOrder<MatRef, M1<T1, n_rows, n_cols, type1, _unused1...>>(type) &&
+                              sameOrder<MatRef, M2<T2, n_rows, n_cols, type2, _unused2...>>(type);
+        static_assert(flat || type == MatType::NORMAL,
+                      "Matrices of different MatType or storage order should be stored into a NORMAL MatRef.");
+        if (flat) {
+        MATREF_PLUS:
+            for (size_t i = 0; i != size(); ++i) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
+                _data[i] = mat_L[i] + mat_R[i];
+            }
+        } else {
+        MATREF_PLUS_NORMAL:
+            for (size_t r = 0; r != n_rows; ++r) {
+                for (size_t c = 0; c != n_cols; ++c) {
+                    FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
+                    FLAMES_PRAGMA(LOOP_FLATTEN)
+                    (*this)(r, c) = mat_L(r, c) + mat_R(r, c);
+                }
+            }
         }
-        return p;
+        return *this;
     }
 
     /**
-     * @brief Conversion from view to a real Mat.
+     * @brief Matrix minus matrix into the referenced matrix.
      *
-     * @return (Mat<T, n_rows, n_cols, type>) The real Mat.
+     * @details The result is stored to the referenced data, e.g. a scratch matrix of a MatWorkspace.
+     *          Matrices of the same MatType and storage order are processed on the data arrays,
+     *          otherwise the referenced matrix should be NORMAL and the result is computed entry by entry.
+     *          You may configure `FLAMES_MAT_MINUS_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing subtraction in parallel.
+     * @tparam M1 The left matrix type.
+     * @tparam _unused1 (unused)
+     * @tparam M2 The right matrix type.
+     * @tparam _unused2 (unused)
+     * @tparam T1 The left matrix element type.
+     * @tparam T2 The right matrix element type.
+     * @tparam type1 The left matrix MatType.
+     * @tparam type2 The right matrix MatType.
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (MatRef&) The subtraction result (a reference to 'this').
      */
-    operator Mat<T, n_rows, n_cols, type>() const {
-        FLAMES_PRAGMA(INLINE);
-        return Mat<T, n_rows, n_cols, type>(const_cast<const T*>(_data), InitAfterwards::NONE);
+    template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+              template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+              typename T2, MatType type1, MatType type2>
+    MatRef& sub(const M1<T1, n_rows, n_cols, type1, _unused1...>& mat_L,
+                const M2<T2, n_rows, n_cols, type2, _unused2...>& mat_R) {
+        constexpr bool flat = type1 == type && type2 == type &&
+                              sameOrder<MatRef, M1<T1, n_rows, n_cols, type1, _unused1...>>(type) &&
+                              sameOrder<MatRef, M2<T2, n_rows, n_cols, type2, _unused2...>>(type);
+        static_assert(flat || type == MatType::NORMAL,
+                      "Matrices of different MatType or storage order should be stored into a NORMAL MatRef.");
+        if (flat) {
+        MATREF_MINUS:
+            for (size_t i = 0; i != size(); ++i) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_MINUS_UNROLL_FACTOR)
+                _data[i] = mat_L[i] - mat_R[i];
+            }
+        } else {
+        MATREF_MINUS_NORMAL:
+            for (size_t r = 0; r != n_rows; ++r) {
+                for (size_t c = 0; c != n_cols; ++c) {
+                    FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_MINUS_UNROLL_FACTOR)
+                    FLAMES_PRAGMA(LOOP_FLATTEN)
+                    (*this)(r, c) = mat_L(r, c) - mat_R(r, c);
+                }
+            }
+        }
+        return *this;
     }
 
     /**
-     * @brief Explicitly make a Mat copy.
+     * @brief Element-wise product of two matrices into the referenced matrix.
      *
-     * @return (Mat<T, n_rows, n_cols, type>) The real Mat.
+     * @details The result is stored to the referenced data, e.g. a scratch matrix of a MatWorkspace.
+     *          Matrices of the same MatType and storage order are processed on the data arrays,
+     *          otherwise the referenced matrix should be NORMAL and the result is computed entry by entry.
+     *          You may configure `FLAMES_MAT_EMUL_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to determine the parallelism.
+     * @tparam M1 The left matrix type.
+     * @tparam _unused1 (unused)
+     * @tparam M2 The right matrix type.
+     * @tparam _unused2 (unused)
+     * @tparam T1 The left matrix element type.
+     * @tparam T2 The right matrix element type.
+     * @tparam type1 The left matrix MatType.
+     * @tparam type2 The right matrix MatType.
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (MatRef&) The element-wise product result (a reference to 'this').
      */
-    Mat<T, n_rows, n_cols, type> asMat() const {
+    template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+              template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+              typename T2, MatType type1, MatType type2>
+    MatRef& emul(const M1<T1, n_rows, n_cols, type1, _unused1...>& mat_L,
+                 const M2<T2, n_rows, n_cols, type2, _unused2...>& mat_R) {
+        constexpr bool flat = type1 == type && type2 == type &&
+                              sameOrder<MatRef, M1<T1, n_rows, n_cols, type1, _unused1...>>(type) &&
+                              sameOrder<MatRef, M2<T2, n_rows, n_cols, type2, _unused2...>>(type);
+        static_assert(flat || type == MatType::NORMAL,
+                      "Matrices of different MatType or storage order should be stored into a NORMAL MatRef.");
+        if (flat) {
+        MATREF_EMUL:
+            for (size_t i = 0; i != size(); ++i) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_EMUL_UNROLL_FACTOR)
+                _data[i] = _Op::mul(mat_L[i], mat_R[i]);
+            }
+        } else {
+        MATREF_EMUL_NORMAL:
+            for (size_t r = 0; r != n_rows; ++r) {
+                for (size_t c = 0; c != n_cols; ++c) {
+                    FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_EMUL_UNROLL_FACTOR)
+                    FLAMES_PRAGMA(LOOP_FLATTEN)
+                    (*this)(r, c) = _Op::mul(mat_L(r, c), mat_R(r, c));
+                }
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Matrix times matrix into the referenced matrix.
+     *
+     * @details The result is stored to the referenced data, e.g. a scratch matrix of a MatWorkspace,
+     *          and the referenced matrix should be NORMAL.
+     *          You may configure `FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing multiplication in parallel.
+     * @tparam M1 The left matrix type.
+     * @tparam _unused1 (unused)
+     * @tparam M2 The right matrix type.
+     * @tparam _unused2 (unused)
+     * @tparam T1 The left matrix element type.
+     * @tparam T2 The right matrix element type.
+     * @tparam type1 The left matrix MatType.
+     * @tparam type2 The right matrix MatType.
+     * @tparam comm The common number (the column number of the left matrix and the row number of the right matrix).
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (MatRef&) The multiplication result (a reference to 'this').
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+              template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+              typename T2, MatType type1, MatType type2, size_t comm>
+    MatRef& mul(const M1<T1, n_rows, comm, type1, _unused1...>& mat_L,
+                const M2<T2, comm, n_cols, type2, _unused2...>& mat_R) {
+        static_assert(type == MatType::NORMAL, "Matrix multiplication should be stored into a NORMAL MatRef.");
+        constexpr bool unroll_cols = _gemmUnrollCols<MatRef, decltype(mat_L), decltype(mat_R)>();
+        _gemmAcc<n_rows, n_cols, comm, FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR, unroll_cols, T>(*this, mat_L, mat_R);
+        return *this;
+    }
+
+    std::conditional_t<order::value == MatOrder::COL_MAJOR, MatView<T, n_cols, n_rows, tType(type)>,
+                       MatViewT<T, n_cols, n_rows, type>>
+    t_() const {
+        return const_cast<T*>(_data);
+    }
+
+    /**
+     * @brief Take a block (submatrix) at a compile-time offset as a read only view.
+     *
+     * @tparam row_ The row index of the first element of the block.
+     * @tparam col_ The column index of the first element of the block.
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @return (BlockView<rows_, cols_, MatOffset<row_, col_>>) The read only block view.
+     */
+    template <size_t row_, size_t col_, size_t rows_, size_t cols_>
+    BlockView<rows_, cols_, MatOffset<row_, col_>> block_() const {
+        return MatView<T, n_rows, n_cols, type, order>(_data);
+    }
+
+    /**
+     * @brief Take a block (submatrix) at a runtime offset as a read only view.
+     *
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @param row The row index of the first element of the block.
+     * @param col The column index of the first element of the block.
+     * @return (BlockView<rows_, cols_>) The read only block view.
+     */
+    template <size_t rows_, size_t cols_>
+    BlockView<rows_, cols_> block_(size_t row, size_t col) const {
+        return { MatView<T, n_rows, n_cols, type, order>(_data), row, col };
+    }
+
+    /**
+     * @brief Take a block (submatrix) at a compile-time offset as a writable view.
+     *
+     * @details The block should be fully stored in the matrix (e.g. within the upper triangle of an UPPER matrix).
+     * @tparam row_ The row index of the first element of the block.
+     * @tparam col_ The column index of the first element of the block.
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @return (BlockRef<rows_, cols_, MatOffset<row_, col_>>) The writable block view.
+     */
+    template <size_t row_, size_t col_, size_t rows_, size_t cols_>
+    BlockRef<rows_, cols_, MatOffset<row_, col_>> block_() {
+        return *this;
+    }
+
+    /**
+     * @brief Take a block (submatrix) at a runtime offset as a writable view.
+     *
+     * @details The block should be fully stored in the matrix (e.g. within the upper triangle of an UPPER matrix).
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @param row The row index of the first element of the block.
+     * @param col The column index of the first element of the block.
+     * @return (BlockRef<rows_, cols_>) The writable block view.
+     */
+    template <size_t rows_, size_t cols_>
+    BlockRef<rows_, cols_> block_(size_t row, size_t col) {
+        return { *this, row, col };
+    }
+
+    template <typename Tp = T>
+    Tp power() const {
+        Tp p = 0;
+        for (size_t i = 0; i != size(); ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_POWER_UNROLL_FACTOR)
+            p += static_cast<Tp>(_data[i] * _data[i]);
+        }
+        return p;
+    }
+
+    template <typename Tp = T>
+    Tp abssum() const {
+        Tp p = 0;
+        for (size_t i = 0; i != size(); ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_POWER_UNROLL_FACTOR)
+            auto d = _data[i];
+            if (d > 0) p += static_cast<Tp>(d);
+        }
+        return p;
+    }
+
+    /**
+     * @brief Conversion from view to a real Mat.
+     *
+     * @return (Mat<T, n_rows, n_cols, type, order>) The real Mat.
+     */
+    operator Mat<T, n_rows, n_cols, type, order>() const {
         FLAMES_PRAGMA(INLINE);
-        return static_cast<Mat<T, n_rows, n_cols, type>>(*this);
+        return Mat<T, n_rows, n_cols, type, order>(const_cast<const T*>(_data), InitAfterwards::NONE);
+    }
+
+    /**
+     * @brief Explicitly make a Mat copy.
+     *
+     * @return (Mat<T, n_rows, n_cols, type, order>) The real Mat.
+     */
+    Mat<T, n_rows, n_cols, type, order> asMat() const {
+        FLAMES_PRAGMA(INLINE);
+        return static_cast<Mat<T, n_rows, n_cols, type, order>>(*this);
     }
 
     void print(const std::string& str = "", std::ostream& os = std::cout) const { this->asMat().print(str, os); }
 
+    /// The arithmetic operators bound by the operator policy `MatOp` of the element type.
+    using _Op = _OpBind<MatOp<T>>;
+
     //   public: // original private
   public:
     T* const _data;
 };
 
-template <typename T, size_t n_rows, size_t n_cols, MatType type>
+/**
+ * @brief Caller-provided storage for the temporaries of multi-step algorithms.
+ *
+ * @details Scratch matrices are carved out of the workspace as MatRef objects at compile-time offsets,
+ *          so that temporaries whose lifetimes do not overlap can share storage,
+ *          and the same workspace can be reused by consecutive calls (e.g. `Mat::invNSA(mat, ws)`).
+ * @tparam T Element type.
+ * @tparam size_ The number of elements.
+ * @tparam policy The storage policy.
+ */
+template <typename T, size_t size_, typename policy>
+class MatWorkspace {
+  public:
+    using element_type = T;
+    using value_type   = T;
+
+    /**
+     * @brief The data element number.
+     *
+     * @return (constexpr size_t) The size.
+     */
+    inline static constexpr size_t size() noexcept { return size_; }
+
+    /**
+     * @brief Carve a scratch matrix out of the workspace.
+     *
+     * @tparam offset The offset (in elements) of the scratch matrix.
+     * @tparam rows_ The row number of the scratch matrix.
+     * @tparam cols_ The column number of the scratch matrix.
+     * @tparam type_ The MatType of the scratch matrix.
+     * @tparam order_ The storage order of the scratch matrix.
+     * @return (MatRef<T, rows_, cols_, type_, order_>) The scratch matrix.
+     */
+    template <size_t offset, size_t rows_, size_t cols_, MatType type_ = MatType::NORMAL,
+              typename order_ = MATORDER_ROW_MAJOR>
+    MatRef<T, rows_, cols_, type_, order_> get() {
+        static_assert(offset + MatRef<T, rows_, cols_, type_, order_>::size() <= size_,
+                      "The scratch matrix should be within the workspace.");
+        return _data.data + offset;
+    }
+
+    /**
+     * @brief Get the raw data array pointer.
+     *
+     * @return (T*) Raw data pointer.
+     */
+    T* rawDataPtr() { return _data; }
+
+  private:
+    _StorageArray<T, size_, policy> _data;
+};
+
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename order>
 class MatViewOpp {
   public:
     /**
@@ -7631,7 +9597,7 @@ class MatViewOpp {
      *
      * @param m The original matrix.
      */
-    MatViewOpp(const Mat<T, n_cols, n_rows, type>& m) : _data(m.rawDataPtr()) {}
+    MatViewOpp(const Mat<T, n_rows, n_cols, type, order>& m) : _data(m.rawDataPtr()) {}
 
     /**
      * @brief Copy constructor.
@@ -7655,6 +9621,15 @@ class MatViewOpp {
                                            : (1 + n_rows) * n_rows / 2;
     }
 
+    /**
+     * @brief Get the storage order of the viewed data array.
+     *
+     * @return (constexpr MatOrder) The storage order.
+     */
+    inline static constexpr MatOrder storageOrder() noexcept { return order::value; }
+
+    inline static constexpr bool isColMajor() noexcept { return order::value == MatOrder::COL_MAJOR; }
+
     /**
      * @brief Get the read only data element from row and column index.
      *
@@ -7666,7 +9641,10 @@ class MatViewOpp {
         FLAMES_PRAGMA(INLINE)
         assert(r < n_rows && "Matrix row index should be within range");
         assert(c < n_cols && "Matrix col index should be within range");
-        if (type == MatType::NORMAL) {
+        if (isColMajor()) {
+            // column major storage is the row major storage of the transpose
+            return -MatView<T, n_cols, n_rows, tType(type)>(_data)(c, r);
+        } else if (type == MatType::NORMAL) {
             return -_data[r * n_cols + c];
         } else if (type == MatType::DIAGONAL) {
             if (r == c) return -_data[r];
@@ -7714,21 +9692,21 @@ class MatViewOpp {
     /**
      * @brief Conversion from view to a real Mat.
      *
-     * @return (Mat<T, n_rows, n_cols, type>) The real Mat.
+     * @return (Mat<T, n_rows, n_cols, type, order>) The real Mat.
      */
-    operator Mat<T, n_rows, n_cols, type>() const {
+    operator Mat<T, n_rows, n_cols, type, order>() const {
         FLAMES_PRAGMA(INLINE);
-        return Mat<T, n_rows, n_cols, type>(_data, InitAfterwards::OPP);
+        return Mat<T, n_rows, n_cols, type, order>(_data, InitAfterwards::OPP);
     }
 
     /**
      * @brief Explicitly make a Mat copy.
      *
-     * @return (Mat<T, n_rows, n_cols, type>) The real Mat.
+     * @return (Mat<T, n_rows, n_cols, type, order>) The real Mat.
      */
-    Mat<T, n_rows, n_cols, type> asMat() const {
+    Mat<T, n_rows, n_cols, type, order> asMat() const {
         FLAMES_PRAGMA(INLINE);
-        return static_cast<Mat<T, n_rows, n_cols, type>>(*this);
+        return static_cast<Mat<T, n_rows, n_cols, type, order>>(*this);
     }
 
   public: // original private
@@ -7884,7 +9862,7 @@ class MatViewT {
     T* const _data;
 };
 
-template <typename T, size_t N, size_t N_, MatType type, typename type_parent>
+template <typename T, size_t N, size_t N_, MatType type, typename type_parent, typename order_parent>
 class MatViewDiagMat {
   public:
     /**
@@ -7892,7 +9870,7 @@ class MatViewDiagMat {
      *
      * @param m The original matrix.
      */
-    MatViewDiagMat(const Mat<T, N, N, matType<type_parent>()>& m) : _data(m.rawDataPtr()) {
+    MatViewDiagMat(const Mat<T, N, N, matType<type_parent>(), order_parent>& m) : _data(m.rawDataPtr()) {
         static_assert(type == MatType::DIAGONAL && N == N_, "DiagMat is and comes from a square matrix.");
     }
 
@@ -7949,7 +9927,8 @@ class MatViewDiagMat {
      */
     T operator()(size_t r, size_t c) const {
         if (r != c) return T(0);
-        constexpr MatType p_type = pType();
+        // a column major diagonal is read from the row major storage of the transpose
+        constexpr MatType p_type = order_parent::value == MatOrder::COL_MAJOR ? tType(pType()) : pType();
         if (p_type == MatType::NORMAL) {
             return _data[r * N + c];
         } else if (p_type == MatType::DIAGONAL) {
@@ -8020,7 +9999,7 @@ class MatViewDiagMat {
     const T* _data;
 };
 
-template <typename T, size_t N, size_t n_cols, MatType type, typename type_parent>
+template <typename T, size_t N, size_t n_cols, MatType type, typename type_parent, typename order_parent>
 class MatViewDiagVec {
   public:
     /**
@@ -8028,7 +10007,7 @@ class MatViewDiagVec {
      *
      * @param m The original matrix.
      */
-    MatViewDiagVec(const Mat<T, N, N, matType<type_parent>()>& m) : _data(m.rawDataPtr()) {
+    MatViewDiagVec(const Mat<T, N, N, matType<type_parent>(), order_parent>& m) : _data(m.rawDataPtr()) {
         static_assert(n_cols == 1, "DiagVec is a column vector.");
     }
 
@@ -8085,7 +10064,8 @@ class MatViewDiagVec {
      */
     T operator()(size_t r, size_t c) const {
         assert(c == 0 && "Column vector's column index should always be 0.");
-        constexpr MatType p_type = pType();
+        // a column major diagonal is read from the row major storage of the transpose
+        constexpr MatType p_type = order_parent::value == MatOrder::COL_MAJOR ? tType(pType()) : pType();
         if (p_type == MatType::NORMAL) {
             return _data[r * N + r];
         } else if (p_type == MatType::DIAGONAL) {
@@ -8162,39 +10142,85 @@ class MatViewDiagVec {
     const T* _data;
 };
 
-template <typename T, size_t n_rows, size_t N, MatType type, typename type_parent>
-class MatViewDiagRowVec {
+template <typename T, size_t N, size_t n_cols, MatType type, typename type_parent, typename order_parent>
+class MatRefDiag {
   public:
     /**
-     * @brief Construct a new MatViewDiagRowVec object from raw data pointer.
+     * @brief Construct a new MatRefDiag object from raw data pointer.
      *
      * @param m The original matrix.
      */
-    MatViewDiagRowVec(const Mat<T, N, N, matType<type_parent>()>& m) : _data(m.rawDataPtr()) {
-        static_assert(n_rows == 1, "DiagRowVec is a row vector.");
+    MatRefDiag(Mat<T, N, N, matType<type_parent>(), order_parent>& m) : _data(m.rawDataPtr()) {
+        static_assert(n_cols == 1, "DiagVec is a column vector.");
+        static_assert(type == MatType::NORMAL, "We only support limited matType.");
+        static_assert(pType() == MatType::NORMAL || pType() == MatType::DIAGONAL || pType() == MatType::UPPER ||
+                          pType() == MatType::LOWER || pType() == MatType::SYM,
+                      "The diagonal of the parent matrix should be fully stored.");
     }
 
     /**
      * @brief Copy constructor.
      *
-     * @param m Another MatViewDiagRowVec object.
+     * @param m Another MatRefDiag object.
      */
-    MatViewDiagRowVec(const MatViewDiagRowVec& m) : _data(m._data) {}
+    MatRefDiag(const MatRefDiag& m) : _data(m._data) {}
+
+    /**
+     * @brief Copy the elements of a vector into the diagonal.
+     *
+     * @param m Another MatRefDiag object.
+     * @return (MatRefDiag&) A reference to 'this'.
+     */
+    MatRefDiag& operator=(const MatRefDiag& m) {
+        assign(m);
+        return *this;
+    }
+
+    /**
+     * @brief Copy the elements of a vector into the diagonal.
+     *
+     * @tparam M The vector type.
+     * @tparam _unused (unused)
+     * @tparam T2 The vector element type.
+     * @tparam type2 The vector MatType.
+     * @param vec The vector.
+     * @return (MatRefDiag&) A reference to 'this'.
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T2,
+              MatType type2>
+    MatRefDiag& operator=(const M<T2, N, 1, type2, _unused...>& vec) {
+        assign(vec);
+        return *this;
+    }
+
+    template <typename M>
+    void assign(const M& vec) {
+    MATREF_DIAG_COPY:
+        for (size_t i = 0; i != N; ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+            _data[_index(i)] = vec(i, 0);
+        }
+    }
+
+    /**
+     * @brief Set all diagonal elements to a value.
+     *
+     * @param val The value.
+     */
+    void setValue(T val) {
+    MATREF_DIAG_SET_VALUE:
+        for (size_t i = 0; i != N; ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SET_VALUE_UNROLL_FACTOR)
+            _data[_index(i)] = val;
+        }
+    }
 
     /**
      * @brief The data element number.
      *
      * @return (constexpr size_t) The size.
      */
-    inline static constexpr size_t size() noexcept {
-        return type == MatType::NORMAL     ? N * N
-               : type == MatType::DIAGONAL ? N
-               : type == MatType::SCALAR   ? 1
-               : type == MatType::SUPPER   ? (N - 1) * N / 2
-               : type == MatType::SLOWER   ? (N - 1) * N / 2
-               : type == MatType::ASYM     ? (N - 1) * N / 2
-                                           : (1 + N) * N / 2;
-    }
+    inline static constexpr size_t size() noexcept { return N; }
 
     /**
      * @brief Parent matrix as MatType.
@@ -8211,30 +10237,15 @@ class MatViewDiagRowVec {
      * @return (T) The element value.
      */
     T operator()(size_t r, size_t c) const {
-        assert(r == 0 && "Row vector's row index should always be 0.");
-        constexpr MatType p_type = pType();
-        if (p_type == MatType::NORMAL) {
-            return _data[c * N + c];
-        } else if (p_type == MatType::DIAGONAL) {
-            return _data[c];
-        } else if (p_type == MatType::SCALAR) {
-            return _data[0];
-        } else if (p_type == MatType::UPPER) {
-            return _data[(2 * N + 1 - c) * c / 2];
-        } else if (p_type == MatType::LOWER) {
-            return _data[(1 + c) * c / 2 + c];
-        } else if (p_type == MatType::SUPPER) {
-            return T(0);
-        } else if (p_type == MatType::SLOWER) {
-            return T(0);
-        } else if (p_type == MatType::SYM) {
-            return _data[(2 * N + 1 - c) * c / 2];
-        } else if (p_type == MatType::ASYM) {
-            return T(0);
-        } else {
-            // Normally it is impossible to reach here.
-            assert(!"Impossible! Unknown MatType!");
-        }
+        assert(c == 0 && "Column vector's column index should always be 0.");
+        assert(r < N && "Matrix row index should be within range");
+        return _data[_index(r)];
+    }
+
+    T& operator()(size_t r, size_t c) {
+        assert(c == 0 && "Column vector's column index should always be 0.");
+        assert(r < N && "Matrix row index should be within range");
+        return _data[_index(r)];
     }
 
     /**
@@ -8243,16 +10254,18 @@ class MatViewDiagRowVec {
      * @param index The index.
      * @return (T) The data.
      */
-    T operator[](size_t index) const { return (*this)(0, index); }
+    T operator[](size_t index) const { return (*this)(index, 0); }
+
+    T& operator[](size_t index) { return (*this)(index, 0); }
 
     /**
      * @brief Conversion from view to a real Mat.
      *
-     * @return (RowVec<T, N>) The real Mat.
+     * @return (Vec<T, N>) The real Mat.
      */
-    operator RowVec<T, N>() const {
-        RowVec<T, N> mat;
-    MAT_COPY_DIAG:
+    operator Vec<T, N>() const {
+        Vec<T, N> mat;
+    MAT_COPY_DIAG_REF:
         for (size_t i = 0; i != N; ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
             mat[i] = (*this)[i];
@@ -8263,41 +10276,185 @@ class MatViewDiagRowVec {
     /**
      * @brief Explicitly make a Mat copy.
      *
-     * @return (RowVec<T, N>) The real Mat.
+     * @return (Vec<T, N>) The real Mat.
      */
-    RowVec<T, N> asMat() const {
+    Vec<T, N> asMat() const {
         FLAMES_PRAGMA(INLINE);
-        return static_cast<RowVec<T, N>>(*this);
+        return static_cast<Vec<T, N>>(*this);
     }
 
     /**
-     * @brief Explicitly make a Mat (RowVec) copy.
+     * @brief Explicitly make a Mat (Vec) copy.
      *
-     * @return (RowVec<T, N>) The real Mat.
+     * @return (Vec<T, N>) The real Mat.
      */
-    RowVec<T, N> asRowVec() const {
+    Vec<T, N> asVec() const {
         FLAMES_PRAGMA(INLINE);
-        return static_cast<RowVec<T, N>>(*this);
+        return static_cast<Vec<T, N>>(*this);
     }
 
-  public: // original private
+    void print(const std::string& str = "", std::ostream& os = std::cout) const { this->asMat().print(str, os); }
+
+  private:
     /**
-     * @brief Raw data pointer.
+     * @brief The data array index of a diagonal element.
      *
-     * @note This contents will not be modified.
+     * @details A column major UPPER (LOWER) matrix is stored as the row major LOWER (UPPER) transpose.
+     * @param i The diagonal index.
+     * @return (constexpr size_t) The data array index.
      */
-    const T* _data;
-};
+    inline static constexpr size_t _index(size_t i) noexcept {
+        constexpr bool col_major = order_parent::value == MatOrder::COL_MAJOR;
+        return pType() == MatType::NORMAL     ? i * N + i
+               : pType() == MatType::DIAGONAL ? i
+               : (pType() == MatType::UPPER) != col_major || pType() == MatType::SYM ? (2 * N + 1 - i) * i / 2
+                                                                                     : (1 + i) * i / 2 + i;
+    }
 
-template <typename T, size_t N, size_t N_, MatType type, typename type_parent>
-class MatViewOffDiag {
+  public: // original private
+    /**
+     * @brief Raw data pointer.
+     */
+    T* const _data;
+};
+
+template <typename T, size_t n_rows, size_t N, MatType type, typename type_parent, typename order_parent>
+class MatViewDiagRowVec {
+  public:
+    /**
+     * @brief Construct a new MatViewDiagRowVec object from raw data pointer.
+     *
+     * @param m The original matrix.
+     */
+    MatViewDiagRowVec(const Mat<T, N, N, matType<type_parent>(), order_parent>& m) : _data(m.rawDataPtr()) {
+        static_assert(n_rows == 1, "DiagRowVec is a row vector.");
+    }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param m Another MatViewDiagRowVec object.
+     */
+    MatViewDiagRowVec(const MatViewDiagRowVec& m) : _data(m._data) {}
+
+    /**
+     * @brief The data element number.
+     *
+     * @return (constexpr size_t) The size.
+     */
+    inline static constexpr size_t size() noexcept {
+        return type == MatType::NORMAL     ? N * N
+               : type == MatType::DIAGONAL ? N
+               : type == MatType::SCALAR   ? 1
+               : type == MatType::SUPPER   ? (N - 1) * N / 2
+               : type == MatType::SLOWER   ? (N - 1) * N / 2
+               : type == MatType::ASYM     ? (N - 1) * N / 2
+                                           : (1 + N) * N / 2;
+    }
+
+    /**
+     * @brief Parent matrix as MatType.
+     *
+     * @return (constexpr MatType) The MatType.
+     */
+    inline static constexpr MatType pType() noexcept { return matType<type_parent>(); }
+
+    /**
+     * @brief Get the read only data element from row and column index.
+     *
+     * @param r The row index.
+     * @param c The column index.
+     * @return (T) The element value.
+     */
+    T operator()(size_t r, size_t c) const {
+        assert(r == 0 && "Row vector's row index should always be 0.");
+        // a column major diagonal is read from the row major storage of the transpose
+        constexpr MatType p_type = order_parent::value == MatOrder::COL_MAJOR ? tType(pType()) : pType();
+        if (p_type == MatType::NORMAL) {
+            return _data[c * N + c];
+        } else if (p_type == MatType::DIAGONAL) {
+            return _data[c];
+        } else if (p_type == MatType::SCALAR) {
+            return _data[0];
+        } else if (p_type == MatType::UPPER) {
+            return _data[(2 * N + 1 - c) * c / 2];
+        } else if (p_type == MatType::LOWER) {
+            return _data[(1 + c) * c / 2 + c];
+        } else if (p_type == MatType::SUPPER) {
+            return T(0);
+        } else if (p_type == MatType::SLOWER) {
+            return T(0);
+        } else if (p_type == MatType::SYM) {
+            return _data[(2 * N + 1 - c) * c / 2];
+        } else if (p_type == MatType::ASYM) {
+            return T(0);
+        } else {
+            // Normally it is impossible to reach here.
+            assert(!"Impossible! Unknown MatType!");
+        }
+    }
+
+    /**
+     * @brief Get the read only element by array row major index.
+     *
+     * @param index The index.
+     * @return (T) The data.
+     */
+    T operator[](size_t index) const { return (*this)(0, index); }
+
+    /**
+     * @brief Conversion from view to a real Mat.
+     *
+     * @return (RowVec<T, N>) The real Mat.
+     */
+    operator RowVec<T, N>() const {
+        RowVec<T, N> mat;
+    MAT_COPY_DIAG:
+        for (size_t i = 0; i != N; ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+            mat[i] = (*this)[i];
+        }
+        return mat;
+    }
+
+    /**
+     * @brief Explicitly make a Mat copy.
+     *
+     * @return (RowVec<T, N>) The real Mat.
+     */
+    RowVec<T, N> asMat() const {
+        FLAMES_PRAGMA(INLINE);
+        return static_cast<RowVec<T, N>>(*this);
+    }
+
+    /**
+     * @brief Explicitly make a Mat (RowVec) copy.
+     *
+     * @return (RowVec<T, N>) The real Mat.
+     */
+    RowVec<T, N> asRowVec() const {
+        FLAMES_PRAGMA(INLINE);
+        return static_cast<RowVec<T, N>>(*this);
+    }
+
+  public: // original private
+    /**
+     * @brief Raw data pointer.
+     *
+     * @note This contents will not be modified.
+     */
+    const T* _data;
+};
+
+template <typename T, size_t N, size_t N_, MatType type, typename type_parent, typename order_parent>
+class MatViewOffDiag {
   public:
     /**
      * @brief Construct a new MatViewOffDiag object from raw data pointer.
      *
      * @param m The original matrix.
      */
-    MatViewOffDiag(const Mat<T, N, N, matType<type_parent>()>& m) : _data(m.rawDataPtr()) {
+    MatViewOffDiag(const Mat<T, N, N, matType<type_parent>(), order_parent>& m) : _data(m.rawDataPtr()) {
         static_assert(type == MatType::NORMAL && N == N_, "OffDiag is and comes from a square and normal matrix.");
     }
 
@@ -8340,7 +10497,10 @@ class MatViewOffDiag {
     T operator()(size_t r, size_t c) const {
         if (r == c) return T(0);
         constexpr MatType p_type = pType();
-        if (type == MatType::NORMAL) {
+        if (order_parent::value == MatOrder::COL_MAJOR) {
+            // column major storage is the row major storage of the transpose
+            return MatView<T, N, N, tType(p_type)>(_data)(c, r);
+        } else if (type == MatType::NORMAL) {
             return _data[r * N + c];
         } else if (type == MatType::DIAGONAL) {
             if (r == c) return _data[r];
@@ -8358,7 +10518,7 @@ class MatViewOffDiag {
             if (r < c) return _data[(2 * N + 1 - r) * r / 2 + c - 2 * r - 1];
             else return T(0);
         } else if (type == MatType::SLOWER) {
-            if (r >= c) return _data[(1 + r) * r / 2 + c - r];
+            if (r > c) return _data[(1 + r) * r / 2 + c - r];
             else return T(0);
         } else if (type == MatType::SYM) {
             if (r <= c) return _data[(2 * N + 1 - r) * r / 2 + c - r];
@@ -8382,6 +10542,7 @@ class MatViewOffDiag {
      */
     T operator[](size_t index) const {
         if (index % (N + 1) == 0) return T(0);
+        else if (order_parent::value == MatOrder::COL_MAJOR) return (*this)(index / N, index % N);
         else return this->_data[index];
     }
 
@@ -8395,8 +10556,7 @@ class MatViewOffDiag {
     MAT_COPY_OFFDIAG:
         for (size_t i = 0; i != N * N; ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
-            if (i % (N + 1) == 0) mat[i] = 0;
-            else mat[i] = this->_data[i];
+            mat[i] = (*this)[i];
         }
         return mat;
     }
@@ -8921,7 +11081,7 @@ class MatRefRow {
 };
 
 template <size_t first_col, size_t last_col, typename T, size_t n_rows, size_t n_cols, MatType type,
-          typename type_parent>
+          typename type_parent, typename order_parent>
 class MatViewCols {
   public:
     /**
@@ -8929,7 +11089,7 @@ class MatViewCols {
      *
      * @param m The original matrix.
      */
-    MatViewCols(const Mat<T, n_rows, n_cols, matType<type_parent>()>& m) : _data(m.rawDataPtr()) {
+    MatViewCols(const Mat<T, n_rows, n_cols, matType<type_parent>(), order_parent>& m) : _data(m.rawDataPtr()) {
         static_assert(last_col < n_cols, "Take the successive cols by indexes requires 'The indexes should be smaller "
                                          "than the number of the matrix's cols.'");
         static_assert(first_col > 0, "Take the specific col by index requires 'The indexes can't be smaller than 0.'");
@@ -8975,9 +11135,12 @@ class MatViewCols {
     T operator()(size_t r, size_t c) const {
         assert(c < (last_col - first_col + 1) &&
                "The col index must be small than the number of the successive columns .");
-        assert(r > 0 && "The row index can't be smaller than 0.");
+        assert(r < n_rows && "The row index must be small than the number of rows.");
         constexpr MatType p_type = pType();
-        if (p_type == MatType::NORMAL) {
+        if (order_parent::value == MatOrder::COL_MAJOR) {
+            // column major storage is the row major storage of the transpose
+            return MatView<T, n_cols, n_rows, tType(p_type)>(_data)(c + first_col, r);
+        } else if (p_type == MatType::NORMAL) {
             return _data[r * n_cols + c + first_col];
         } else if (p_type == MatType::DIAGONAL) {
             if (r == (c + first_col)) return _data[r];
@@ -9055,7 +11218,7 @@ class MatViewCols {
 };
 
 template <size_t first_row, size_t last_row, typename T, size_t n_rows, size_t n_cols, MatType type,
-          typename type_parent>
+          typename type_parent, typename order_parent>
 class MatViewRows {
   public:
     /**
@@ -9063,7 +11226,7 @@ class MatViewRows {
      *
      * @param m The original matrix.
      */
-    MatViewRows(const Mat<T, n_cols, n_rows, matType<type_parent>()>& m) : _data(m.rawDataPtr()) {
+    MatViewRows(const Mat<T, n_rows, n_cols, matType<type_parent>(), order_parent>& m) : _data(m.rawDataPtr()) {
         static_assert(last_row < n_rows, "Take the successive rows by indexes requires 'The indexes should be smaller "
                                          "than the number of the matrix's rows.'");
         static_assert(first_row > 0, "Take the specific row by index requires 'The indexes can't be smaller than 0.'");
@@ -9107,10 +11270,13 @@ class MatViewRows {
      * @return (T) The element value.
      */
     T operator()(size_t r, size_t c) const {
-        assert(r < last_row - first_row && "The row index must be small than the number of the successive rows .");
-        assert(c > 0 && "The row index can't be smaller than 0.");
+        assert(r <= last_row - first_row && "The row index must be small than the number of the successive rows .");
+        assert(c < n_cols && "The col index must be small than the number of columns.");
         constexpr MatType p_type = pType();
-        if (p_type == MatType::NORMAL) {
+        if (order_parent::value == MatOrder::COL_MAJOR) {
+            // column major storage is the row major storage of the transpose
+            return MatView<T, n_cols, n_rows, tType(p_type)>(_data)(c, r + first_row);
+        } else if (p_type == MatType::NORMAL) {
             return _data[(r + first_row) * n_cols + c];
         } else if (p_type == MatType::DIAGONAL) {
             if ((r + first_row) == c) return _data[r];
@@ -9162,7 +11328,7 @@ class MatViewRows {
     operator Mat<T, last_row - first_row + 1, n_cols, MatType::NORMAL>() const {
         Mat<T, last_row - first_row + 1, n_cols, MatType::NORMAL> mat;
     MAT_COPY_ROWS:
-        for (size_t i = 0; i != n_rows * (last_row - first_row + 1); ++i) {
+        for (size_t i = 0; i != (last_row - first_row + 1) * n_cols; ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
             mat[i] = (*this)[i];
         }
@@ -9199,83 +11365,1083 @@ class MatViewRows {
 };
 
 /**
- * @brief Add two matrices and make a copy.
+ * @brief Read only view version of a rectangular block (submatrix).
  *
- * @details This will call .add() function.
- * @note This function makes a copy so it should only by used for initialization.
- *       Otherwise use .add(Mat_L, mat_R) to avoid the copy operation.
- * @tparam M1 The left matrix type.
- * @tparam _unused1 (unused)
- * @tparam M2 The right matrix type.
- * @tparam _unused2 (unused)
- * @tparam T1 The left matrix element type.
- * @tparam T2 The right matrix element type.
- * @tparam type1 The left matrix MatType.
- * @tparam type2 The right matrix MatType.
- * @param mat_L The left matrix.
- * @param mat_R The right matrix.
- * @return (Mat<T1, n_rows, n_cols, sumType(type1, type2)>) The addition result as a copy.
+ * @details The block is accessed through the parent view with the offset added,
+ *          so no data is copied and it can be used as an operand of matrix operations.
+ *          A compile-time offset (`MatOffset`) resolves the addresses at compile time,
+ *          while `MATOFFSET_DYNAMIC` allows the block to move, e.g. in tiled loops.
  */
-template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
-          template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
-          typename T2, size_t n_rows, size_t n_cols, MatType type1, MatType type2>
-static inline Mat<T1, n_rows, n_cols, sumType(type1, type2)>
-operator+(const M1<T1, n_rows, n_cols, type1, _unused1...>& mat_L,
-          const M2<T2, n_rows, n_cols, type2, _unused2...>& mat_R) {
-    FLAMES_PRAGMA(INLINE)
-    Mat<T1, n_rows, n_cols, type1> mat;
-    return mat.add(mat_L, mat_R);
-}
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename parent, typename offset>
+class MatViewBlock {
+  public:
+    using element_type = T;
+    using value_type   = T;
+    /// Read only block view (of rows_ x cols_ at `offset_`).
+    template <size_t rows_, size_t cols_, typename offset_ = MATOFFSET_DYNAMIC>
+    using BlockView = MatViewBlock<T, rows_, cols_, MatType::NORMAL, MatViewBlock, offset_>;
 
-/**
- * @brief Matrix self plus a matrix.
- *
- * @tparam M The right side matrix type.
- * @tparam _unused (unused)
- * @tparam T1 The left side matrix element type.
- * @tparam T2 The right side matrix element type.
- * @tparam n_rows The number of rows.
- * @tparam n_cols The number of columns.
- * @tparam type1 The left side matrix MatType.
- * @tparam type2 The right side matrix MatType.
- * @param mat_L The left side matrix.
- * @param mat_R The right side matrix.
- * @return (Mat<T1, n_rows, n_cols, type1>&) The addition result (a reference to 'this').
- */
-template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T1, typename T2,
-          size_t n_rows, size_t n_cols, MatType type1, MatType type2>
-static inline Mat<T1, n_rows, n_cols, type1>& operator+=(Mat<T1, n_rows, n_cols, type1>& mat_L,
-                                                         const M<T2, n_rows, n_cols, type2, _unused...>& mat_R) {
-    FLAMES_PRAGMA(INLINE)
-    return mat_L.add(mat_R);
-}
+    /**
+     * @brief Construct a new MatViewBlock object at a compile-time offset.
+     *
+     * @param p The parent view.
+     */
+    MatViewBlock(const parent& p) : _parent(p), _row(offset::row), _col(offset::col) {
+        static_assert(isFixed(), "A block with a runtime offset should be constructed with the offset.");
+        static_assert(type == MatType::NORMAL, "We only support limited matType.");
+        static_assert(offset::row + n_rows <= _MatShape<parent>::rows &&
+                          offset::col + n_cols <= _MatShape<parent>::cols,
+                      "The block should be within the parent matrix.");
+    }
 
-/**
- * @brief Minus two matrices and make a copy.
- *
- * @details This will call .sub() function.
- * @note This function makes a copy so it should only by used for initialization.
- *       Otherwise use .sub(Mat_L, mat_R) to avoid the copy operation.
- * @tparam M1 The left matrix type.
- * @tparam _unused1 (unused)
- * @tparam M2 The right matrix type.
- * @tparam _unused2 (unused)
- * @tparam T1 The left matrix element type.
- * @tparam T2 The right matrix element type.
- * @tparam type1 The left matrix MatType.
- * @tparam type2 The right matrix MatType.
- * @param mat_L The left matrix.
- * @param mat_R The right matrix.
- * @return (Mat<T1, n_rows, n_cols, sumType(type1, type2)>) The subtract result as a copy.
- */
-template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
-          template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
-          typename T2, size_t n_rows, size_t n_cols, MatType type1, MatType type2>
-static inline Mat<T1, n_rows, n_cols, sumType(type1, type2)>
+    /**
+     * @brief Construct a new MatViewBlock object at a runtime offset.
+     *
+     * @param p The parent view.
+     * @param row The row index of the first element of the block.
+     * @param col The column index of the first element of the block.
+     */
+    MatViewBlock(const parent& p, size_t row, size_t col) : _parent(p), _row(row), _col(col) {
+        static_assert(!isFixed(), "A block with a compile-time offset should be constructed without the offset.");
+        static_assert(type == MatType::NORMAL, "We only support limited matType.");
+        assert(row + n_rows <= _MatShape<parent>::rows && col + n_cols <= _MatShape<parent>::cols &&
+               "The block should be within the parent matrix.");
+    }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param m Another MatViewBlock object.
+     */
+    MatViewBlock(const MatViewBlock& m) : _parent(m._parent), _row(m._row), _col(m._col) {}
+
+    /**
+     * @brief The data element number.
+     *
+     * @return (constexpr size_t) The size.
+     */
+    inline static constexpr size_t size() noexcept { return n_rows * n_cols; }
+
+    /**
+     * @brief Whether the block offset is known at compile time.
+     *
+     * @return (constexpr bool) Whether the offset is fixed.
+     */
+    inline static constexpr bool isFixed() noexcept { return !std::is_same<offset, MATOFFSET_DYNAMIC>::value; }
+
+    /**
+     * @brief The row index (in the parent matrix) of the first element of the block.
+     *
+     * @return (size_t) The row offset.
+     */
+    inline size_t rowOffset() const { return isFixed() ? offset::row : _row; }
+
+    /**
+     * @brief The column index (in the parent matrix) of the first element of the block.
+     *
+     * @return (size_t) The column offset.
+     */
+    inline size_t colOffset() const { return isFixed() ? offset::col : _col; }
+
+    /**
+     * @brief Get the read only data element from row and column index.
+     *
+     * @param r The row index.
+     * @param c The column index.
+     * @return (T) The element value.
+     */
+    T operator()(size_t r, size_t c) const {
+        FLAMES_PRAGMA(INLINE)
+        assert(r < n_rows && "Matrix row index should be within range");
+        assert(c < n_cols && "Matrix col index should be within range");
+        return _parent(rowOffset() + r, colOffset() + c);
+    }
+
+    /**
+     * @brief Get the read only element by array row major index.
+     *
+     * @param index The index.
+     * @return (T) The data.
+     */
+    T operator[](size_t index) const { return (*this)(index / n_cols, index % n_cols); }
+
+    /**
+     * @brief Conversion from view to a real Mat.
+     * @return (Mat<T, n_rows, n_cols, MatType::NORMAL>) The real Mat.
+     */
+    operator Mat<T, n_rows, n_cols, MatType::NORMAL>() const {
+        Mat<T, n_rows, n_cols, MatType::NORMAL> mat;
+    MAT_COPY_BLOCK:
+        for (size_t r = 0; r != n_rows; ++r) {
+            for (size_t c = 0; c != n_cols; ++c) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+                FLAMES_PRAGMA(LOOP_FLATTEN)
+                mat(r, c) = (*this)(r, c);
+            }
+        }
+        return mat;
+    }
+
+    /**
+     * @brief Explicitly make a Mat copy.
+     *
+     * @return (Mat<T, n_rows, n_cols, MatType::NORMAL>) The real Mat.
+     */
+    Mat<T, n_rows, n_cols, MatType::NORMAL> asMat() const {
+        FLAMES_PRAGMA(INLINE);
+        return static_cast<Mat<T, n_rows, n_cols, MatType::NORMAL>>(*this);
+    }
+
+    void print(const std::string& str = "", std::ostream& os = std::cout) const { this->asMat().print(str, os); }
+
+    /**
+     * @brief Take a block (submatrix) at a compile-time offset as a read only view.
+     *
+     * @tparam row_ The row index of the first element of the block.
+     * @tparam col_ The column index of the first element of the block.
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @return (BlockView<rows_, cols_, MatOffset<row_, col_>>) The read only block view.
+     */
+    template <size_t row_, size_t col_, size_t rows_, size_t cols_>
+    BlockView<rows_, cols_, MatOffset<row_, col_>> block_() const {
+        return *this;
+    }
+
+    /**
+     * @brief Take a block (submatrix) at a runtime offset as a read only view.
+     *
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @param row The row index of the first element of the block.
+     * @param col The column index of the first element of the block.
+     * @return (BlockView<rows_, cols_>) The read only block view.
+     */
+    template <size_t rows_, size_t cols_>
+    BlockView<rows_, cols_> block_(size_t row, size_t col) const {
+        return { *this, row, col };
+    }
+
+  public: // original private
+    /**
+     * @brief The parent view.
+     *
+     * @note This contents will not be modified.
+     */
+    const parent _parent;
+    /// The runtime row offset.
+    const size_t _row;
+    /// The runtime column offset.
+    const size_t _col;
+};
+
+/**
+ * @brief Writable view version of a rectangular block (submatrix).
+ *
+ * @details The block is accessed through the parent reference with the offset added,
+ *          so it can be both an operand and the destination of matrix operations without copies,
+ *          e.g. to update a Schur complement or a tile of a tiled GEMM in place.
+ *          The block should be fully stored in the parent matrix.
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename parent, typename offset>
+class MatRefBlock {
+  public:
+    using element_type = T;
+    using value_type   = T;
+    /// Read only block view (of rows_ x cols_ at `offset_`).
+    template <size_t rows_, size_t cols_, typename offset_ = MATOFFSET_DYNAMIC>
+    using BlockView = MatViewBlock<T, rows_, cols_, MatType::NORMAL, MatRefBlock, offset_>;
+    /// Writable block view (of rows_ x cols_ at `offset_`).
+    template <size_t rows_, size_t cols_, typename offset_ = MATOFFSET_DYNAMIC>
+    using BlockRef = MatRefBlock<T, rows_, cols_, MatType::NORMAL, MatRefBlock, offset_>;
+
+    /**
+     * @brief Construct a new MatRefBlock object at a compile-time offset.
+     *
+     * @param p The parent reference.
+     */
+    MatRefBlock(const parent& p) : _parent(p), _row(offset::row), _col(offset::col) {
+        static_assert(isFixed(), "A block with a runtime offset should be constructed with the offset.");
+        static_assert(type == MatType::NORMAL, "We only support limited matType.");
+        static_assert(offset::row + n_rows <= _MatShape<parent>::rows &&
+                          offset::col + n_cols <= _MatShape<parent>::cols,
+                      "The block should be within the parent matrix.");
+        static_assert(_blockStored(_MatShape<parent>::kind, offset::row, offset::col, n_rows, n_cols),
+                      "A writable block should be fully stored in the parent matrix.");
+    }
+
+    /**
+     * @brief Construct a new MatRefBlock object at a runtime offset.
+     *
+     * @param p The parent reference.
+     * @param row The row index of the first element of the block.
+     * @param col The column index of the first element of the block.
+     */
+    MatRefBlock(const parent& p, size_t row, size_t col) : _parent(p), _row(row), _col(col) {
+        static_assert(!isFixed(), "A block with a compile-time offset should be constructed without the offset.");
+        static_assert(type == MatType::NORMAL, "We only support limited matType.");
+        assert(row + n_rows <= _MatShape<parent>::rows && col + n_cols <= _MatShape<parent>::cols &&
+               "The block should be within the parent matrix.");
+        assert(_blockStored(_MatShape<parent>::kind, row, col, n_rows, n_cols) &&
+               "A writable block should be fully stored in the parent matrix.");
+    }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param m Another MatRefBlock object.
+     */
+    MatRefBlock(const MatRefBlock& m) : _parent(m._parent), _row(m._row), _col(m._col) {}
+
+    /**
+     * @brief The data element number.
+     *
+     * @return (constexpr size_t) The size.
+     */
+    inline static constexpr size_t size() noexcept { return n_rows * n_cols; }
+
+    /**
+     * @brief Whether the block offset is known at compile time.
+     *
+     * @return (constexpr bool) Whether the offset is fixed.
+     */
+    inline static constexpr bool isFixed() noexcept { return !std::is_same<offset, MATOFFSET_DYNAMIC>::value; }
+
+    /**
+     * @brief The row index (in the parent matrix) of the first element of the block.
+     *
+     * @return (size_t) The row offset.
+     */
+    inline size_t rowOffset() const { return isFixed() ? offset::row : _row; }
+
+    /**
+     * @brief The column index (in the parent matrix) of the first element of the block.
+     *
+     * @return (size_t) The column offset.
+     */
+    inline size_t colOffset() const { return isFixed() ? offset::col : _col; }
+
+    /**
+     * @brief Get the read only data element from row and column index.
+     *
+     * @param r The row index.
+     * @param c The column index.
+     * @return (T) The element value.
+     */
+    T operator()(size_t r, size_t c) const {
+        FLAMES_PRAGMA(INLINE)
+        assert(r < n_rows && "Matrix row index should be within range");
+        assert(c < n_cols && "Matrix col index should be within range");
+        return _parent(rowOffset() + r, colOffset() + c);
+    }
+
+    /**
+     * @brief Get the writeable data element from row and column index.
+     *
+     * @param r The row index.
+     * @param c The column index.
+     * @return (T&) The writeable element.
+     */
+    T& operator()(size_t r, size_t c) {
+        FLAMES_PRAGMA(INLINE)
+        assert(r < n_rows && "Matrix row index should be within range");
+        assert(c < n_cols && "Matrix col index should be within range");
+        return _parent(rowOffset() + r, colOffset() + c);
+    }
+
+    /**
+     * @brief Get the read only element by array row major index.
+     *
+     * @param index The index.
+     * @return (T) The data.
+     */
+    T operator[](size_t index) const { return (*this)(index / n_cols, index % n_cols); }
+
+    T& operator[](size_t index) { return (*this)(index / n_cols, index % n_cols); }
+
+    /**
+     * @brief Conversion from view to a real Mat.
+     * @return (Mat<T, n_rows, n_cols, MatType::NORMAL>) The real Mat.
+     */
+    operator Mat<T, n_rows, n_cols, MatType::NORMAL>() const {
+        Mat<T, n_rows, n_cols, MatType::NORMAL> mat;
+    MAT_COPY_BLOCK:
+        for (size_t r = 0; r != n_rows; ++r) {
+            for (size_t c = 0; c != n_cols; ++c) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+                FLAMES_PRAGMA(LOOP_FLATTEN)
+                mat(r, c) = (*this)(r, c);
+            }
+        }
+        return mat;
+    }
+
+    /**
+     * @brief Explicitly make a Mat copy.
+     *
+     * @return (Mat<T, n_rows, n_cols, MatType::NORMAL>) The real Mat.
+     */
+    Mat<T, n_rows, n_cols, MatType::NORMAL> asMat() const {
+        FLAMES_PRAGMA(INLINE);
+        return static_cast<Mat<T, n_rows, n_cols, MatType::NORMAL>>(*this);
+    }
+
+    void print(const std::string& str = "", std::ostream& os = std::cout) const { this->asMat().print(str, os); }
+
+    /**
+     * @brief Take a block (submatrix) at a compile-time offset as a read only view.
+     *
+     * @tparam row_ The row index of the first element of the block.
+     * @tparam col_ The column index of the first element of the block.
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @return (BlockView<rows_, cols_, MatOffset<row_, col_>>) The read only block view.
+     */
+    template <size_t row_, size_t col_, size_t rows_, size_t cols_>
+    BlockView<rows_, cols_, MatOffset<row_, col_>> block_() const {
+        return *this;
+    }
+
+    /**
+     * @brief Take a block (submatrix) at a runtime offset as a read only view.
+     *
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @param row The row index of the first element of the block.
+     * @param col The column index of the first element of the block.
+     * @return (BlockView<rows_, cols_>) The read only block view.
+     */
+    template <size_t rows_, size_t cols_>
+    BlockView<rows_, cols_> block_(size_t row, size_t col) const {
+        return { *this, row, col };
+    }
+
+    /**
+     * @brief Take a block (submatrix) at a compile-time offset as a writable view.
+     *
+     * @details The block should be fully stored in the matrix (e.g. within the upper triangle of an UPPER matrix).
+     * @tparam row_ The row index of the first element of the block.
+     * @tparam col_ The column index of the first element of the block.
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @return (BlockRef<rows_, cols_, MatOffset<row_, col_>>) The writable block view.
+     */
+    template <size_t row_, size_t col_, size_t rows_, size_t cols_>
+    BlockRef<rows_, cols_, MatOffset<row_, col_>> block_() {
+        return *this;
+    }
+
+    /**
+     * @brief Take a block (submatrix) at a runtime offset as a writable view.
+     *
+     * @details The block should be fully stored in the matrix (e.g. within the upper triangle of an UPPER matrix).
+     * @tparam rows_ The row number of the block.
+     * @tparam cols_ The column number of the block.
+     * @param row The row index of the first element of the block.
+     * @param col The column index of the first element of the block.
+     * @return (BlockRef<rows_, cols_>) The writable block view.
+     */
+    template <size_t rows_, size_t cols_>
+    BlockRef<rows_, cols_> block_(size_t row, size_t col) {
+        return { *this, row, col };
+    }
+
+    /**
+     * @brief Copy the elements of a matrix into the block.
+     *
+     * @param m Another block.
+     * @return (MatRefBlock&) A reference to 'this'.
+     */
+    MatRefBlock& operator=(const MatRefBlock& m) { return assign(m); }
+
+    /**
+     * @brief Copy the elements of a matrix into the block.
+     *
+     * @tparam M The matrix type.
+     * @tparam _unused (unused)
+     * @tparam T2 The matrix element type.
+     * @tparam type2 The matrix MatType.
+     * @param mat The matrix.
+     * @return (MatRefBlock&) A reference to 'this'.
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T2,
+              MatType type2>
+    MatRefBlock& operator=(const M<T2, n_rows, n_cols, type2, _unused...>& mat) {
+        return assign(mat);
+    }
+
+    template <typename M>
+    MatRefBlock& assign(const M& mat) {
+    MATREF_BLOCK_COPY:
+        for (size_t r = 0; r != n_rows; ++r) {
+            for (size_t c = 0; c != n_cols; ++c) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+                FLAMES_PRAGMA(LOOP_FLATTEN)
+                (*this)(r, c) = mat(r, c);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Set all elements of the block to a value.
+     *
+     * @param val The value.
+     */
+    void setValue(T val) {
+    MATREF_BLOCK_SET_VALUE:
+        for (size_t r = 0; r != n_rows; ++r) {
+            for (size_t c = 0; c != n_cols; ++c) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SET_VALUE_UNROLL_FACTOR)
+                FLAMES_PRAGMA(LOOP_FLATTEN)
+                (*this)(r, c) = val;
+            }
+        }
+    }
+
+    /**
+     * @brief Matrix plus matrix in place.
+     *
+     * @details You may configure `FLAMES_MAT_PLUS_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing addition in parallel.
+     * @tparam M The right matrix type.
+     * @tparam _unused (unused)
+     * @tparam T2 The right matrix element type.
+     * @tparam type2 The right matrix MatType.
+     * @param mat_R The right matrix.
+     * @return (MatRefBlock&) The addition result (a reference to 'this').
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T2,
+              MatType type2>
+    MatRefBlock& add(const M<T2, n_rows, n_cols, type2, _unused...>& mat_R) {
+    MATREF_BLOCK_PLUS_INPLACE:
+        for (size_t r = 0; r != n_rows; ++r) {
+            for (size_t c = 0; c != n_cols; ++c) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
+                FLAMES_PRAGMA(LOOP_FLATTEN)
+                (*this)(r, c) += mat_R(r, c);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Matrix minus matrix in place.
+     *
+     * @details You may configure `FLAMES_MAT_MINUS_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing subtraction in parallel.
+     * @tparam M The right matrix type.
+     * @tparam _unused (unused)
+     * @tparam T2 The right matrix element type.
+     * @tparam type2 The right matrix MatType.
+     * @param mat_R The right matrix.
+     * @return (MatRefBlock&) The subtraction result (a reference to 'this').
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T2,
+              MatType type2>
+    MatRefBlock& sub(const M<T2, n_rows, n_cols, type2, _unused...>& mat_R) {
+    MATREF_BLOCK_MINUS_INPLACE:
+        for (size_t r = 0; r != n_rows; ++r) {
+            for (size_t c = 0; c != n_cols; ++c) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_MINUS_UNROLL_FACTOR)
+                FLAMES_PRAGMA(LOOP_FLATTEN)
+                (*this)(r, c) -= mat_R(r, c);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Matrix plus matrix into the block.
+     *
+     * @details You may configure `FLAMES_MAT_PLUS_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing addition in parallel.
+     * @tparam M1 The left matrix type.
+     * @tparam _unused1 (unused)
+     * @tparam M2 The right matrix type.
+     * @tparam _unused2 (unused)
+     * @tparam T1 The left matrix element type.
+     * @tparam T2 The right matrix element type.
+     * @tparam type1 The left matrix MatType.
+     * @tparam type2 The right matrix MatType.
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (MatRefBlock&) The addition result (a reference to 'this').
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+              template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+              typename T2, MatType type1, MatType type2>
+    MatRefBlock& add(const M1<T1, n_rows, n_cols, type1, _unused1...>& mat_L,
+                    const M2<T2, n_rows, n_cols, type2, _unused2...>& mat_R) {
+    MATREF_BLOCK_PLUS:
+        for (size_t r = 0; r != n_rows; ++r) {
+            for (size_t c = 0; c != n_cols; ++c) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
+                FLAMES_PRAGMA(LOOP_FLATTEN)
+                (*this)(r, c) = mat_L(r, c) + mat_R(r, c);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Matrix minus matrix into the block.
+     *
+     * @details You may configure `FLAMES_MAT_MINUS_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing subtraction in parallel.
+     * @tparam M1 The left matrix type.
+     * @tparam _unused1 (unused)
+     * @tparam M2 The right matrix type.
+     * @tparam _unused2 (unused)
+     * @tparam T1 The left matrix element type.
+     * @tparam T2 The right matrix element type.
+     * @tparam type1 The left matrix MatType.
+     * @tparam type2 The right matrix MatType.
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (MatRefBlock&) The subtraction result (a reference to 'this').
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+              template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+              typename T2, MatType type1, MatType type2>
+    MatRefBlock& sub(const M1<T1, n_rows, n_cols, type1, _unused1...>& mat_L,
+                    const M2<T2, n_rows, n_cols, type2, _unused2...>& mat_R) {
+    MATREF_BLOCK_MINUS:
+        for (size_t r = 0; r != n_rows; ++r) {
+            for (size_t c = 0; c != n_cols; ++c) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_MINUS_UNROLL_FACTOR)
+                FLAMES_PRAGMA(LOOP_FLATTEN)
+                (*this)(r, c) = mat_L(r, c) - mat_R(r, c);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Element-wise product of two matrices into the block.
+     *
+     * @details You may configure `FLAMES_MAT_EMUL_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to determine the parallelism.
+     * @tparam M1 The left matrix type.
+     * @tparam _unused1 (unused)
+     * @tparam M2 The right matrix type.
+     * @tparam _unused2 (unused)
+     * @tparam T1 The left matrix element type.
+     * @tparam T2 The right matrix element type.
+     * @tparam type1 The left matrix MatType.
+     * @tparam type2 The right matrix MatType.
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (MatRefBlock&) The element-wise product result (a reference to 'this').
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+              template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+              typename T2, MatType type1, MatType type2>
+    MatRefBlock& emul(const M1<T1, n_rows, n_cols, type1, _unused1...>& mat_L,
+                     const M2<T2, n_rows, n_cols, type2, _unused2...>& mat_R) {
+    MATREF_BLOCK_EMUL:
+        for (size_t r = 0; r != n_rows; ++r) {
+            for (size_t c = 0; c != n_cols; ++c) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_EMUL_UNROLL_FACTOR)
+                FLAMES_PRAGMA(LOOP_FLATTEN)
+                (*this)(r, c) = _Op::mul(mat_L(r, c), mat_R(r, c));
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Matrix times matrix into the block.
+     *
+     * @details You may configure `FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing multiplication in parallel.
+     * @tparam M1 The left matrix type.
+     * @tparam _unused1 (unused)
+     * @tparam M2 The right matrix type.
+     * @tparam _unused2 (unused)
+     * @tparam T1 The left matrix element type.
+     * @tparam T2 The right matrix element type.
+     * @tparam type1 The left matrix MatType.
+     * @tparam type2 The right matrix MatType.
+     * @tparam comm The common number (the column number of the left matrix and the row number of the right matrix).
+     * @param mat_L The left matrix.
+     * @param mat_R The right matrix.
+     * @return (MatRefBlock&) The multiplication result (a reference to 'this').
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+              template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+              typename T2, MatType type1, MatType type2, size_t comm>
+    MatRefBlock& mul(const M1<T1, n_rows, comm, type1, _unused1...>& mat_L,
+                     const M2<T2, comm, n_cols, type2, _unused2...>& mat_R) {
+        _gemmAcc<n_rows, n_cols, comm, FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR, false, T>(*this, mat_L, mat_R);
+        return *this;
+    }
+
+  private:
+    /// The arithmetic operators bound by the operator policy `MatOp` of the element type.
+    using _Op = _OpBind<MatOp<T>>;
+
+  public: // original private
+    /// The parent reference.
+    parent _parent;
+    /// The runtime row offset.
+    const size_t _row;
+    /// The runtime column offset.
+    const size_t _col;
+};
+
+/**
+ * @brief Read only view of two matrices concatenated horizontally, i.e. [M1 | M2].
+ *
+ * @details The parts are held as views (a Mat is held by a MatView), so no data is copied,
+ *          and `operator()` dispatches to the part that holds the element.
+ *          Any part can be a Mat, a view, a SCALAR or DIAGONAL matrix (e.g. √σI), or another concatenation.
+ *          `Mat::mul` splits its loops on the block boundary instead of branching per element.
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename M1, typename M2>
+class MatViewHCat {
+  public:
+    using element_type = T;
+    using value_type   = T;
+
+    /**
+     * @brief Construct a new MatViewHCat object from the two parts.
+     *
+     * @param first The left part.
+     * @param second The right part.
+     */
+    MatViewHCat(const M1& first, const M2& second) : _first(first), _second(second) {
+        static_assert(type == MatType::NORMAL, "We only support limited matType.");
+        static_assert(_MatShape<M1>::rows == n_rows && _MatShape<M2>::rows == n_rows,
+                      "The parts of a horizontal concatenation should have the same row number.");
+        static_assert(_MatShape<M1>::cols + _MatShape<M2>::cols == n_cols, "Matrix dimension should meet.");
+    }
+
+    /// A temporary Mat cannot be a part, since only a view of its data is kept.
+    template <typename T1, size_t rows_, size_t cols_, MatType type_, typename order_>
+    MatViewHCat(Mat<T1, rows_, cols_, type_, order_>&& first, const M2& second) = delete;
+    template <typename T2, size_t rows_, size_t cols_, MatType type_, typename order_>
+    MatViewHCat(const M1& first, Mat<T2, rows_, cols_, type_, order_>&& second) = delete;
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param m Another MatViewHCat object.
+     */
+    MatViewHCat(const MatViewHCat& m) : _first(m._first), _second(m._second) {}
+
+    /**
+     * @brief The data element number.
+     *
+     * @return (constexpr size_t) The size.
+     */
+    inline static constexpr size_t size() noexcept { return n_rows * n_cols; }
+
+    /**
+     * @brief Get the read only data element from row and column index.
+     *
+     * @param r The row index.
+     * @param c The column index.
+     * @return (T) The element value.
+     */
+    T operator()(size_t r, size_t c) const {
+        FLAMES_PRAGMA(INLINE)
+        assert(r < n_rows && "Matrix row index should be within range");
+        assert(c < n_cols && "Matrix col index should be within range");
+        return c < _MatShape<M1>::cols ? _first(r, c) : _second(r, c - _MatShape<M1>::cols);
+    }
+
+    /**
+     * @brief Get the read only element by array row major index.
+     *
+     * @param index The index.
+     * @return (T) The data.
+     */
+    T operator[](size_t index) const { return (*this)(index / n_cols, index % n_cols); }
+
+    /**
+     * @brief Conversion from view to a real Mat.
+     * @return (Mat<T, n_rows, n_cols, MatType::NORMAL>) The real Mat.
+     */
+    operator Mat<T, n_rows, n_cols, MatType::NORMAL>() const {
+        Mat<T, n_rows, n_cols, MatType::NORMAL> mat;
+    MAT_COPY_HCAT:
+        for (size_t r = 0; r != n_rows; ++r) {
+            for (size_t c = 0; c != n_cols; ++c) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+                FLAMES_PRAGMA(LOOP_FLATTEN)
+                mat(r, c) = (*this)(r, c);
+            }
+        }
+        return mat;
+    }
+
+    /**
+     * @brief Explicitly make a Mat copy.
+     *
+     * @return (Mat<T, n_rows, n_cols, MatType::NORMAL>) The real Mat.
+     */
+    Mat<T, n_rows, n_cols, MatType::NORMAL> asMat() const {
+        FLAMES_PRAGMA(INLINE);
+        return static_cast<Mat<T, n_rows, n_cols, MatType::NORMAL>>(*this);
+    }
+
+    void print(const std::string& str = "", std::ostream& os = std::cout) const { this->asMat().print(str, os); }
+
+    /**
+     * @brief Transpose view, i.e. [M1 | M2]^T = [M1^T; M2^T].
+     *
+     * @details Every part should have a transpose view `t_()`.
+     * @return (MatViewVCat) The transposed concatenation view.
+     */
+    template <typename P1 = M1, typename P2 = M2>
+    MatViewVCat<T, n_cols, n_rows, MatType::NORMAL, decltype(std::declval<const P1&>().t_()),
+                decltype(std::declval<const P2&>().t_())>
+    t_() const {
+        return { _first.t_(), _second.t_() };
+    }
+
+  public: // original private
+    /// The left part.
+    const M1 _first;
+    /// The right part.
+    const M2 _second;
+};
+
+/**
+ * @brief Read only view of two matrices concatenated vertically, i.e. [M1; M2].
+ *
+ * @details The parts are held as views (a Mat is held by a MatView), so no data is copied,
+ *          and `operator()` dispatches to the part that holds the element.
+ *          Any part can be a Mat, a view, a SCALAR or DIAGONAL matrix (e.g. √σI), or another concatenation.
+ *          `Mat::mul` splits its loops on the block boundary instead of branching per element.
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename M1, typename M2>
+class MatViewVCat {
+  public:
+    using element_type = T;
+    using value_type   = T;
+
+    /**
+     * @brief Construct a new MatViewVCat object from the two parts.
+     *
+     * @param first The top part.
+     * @param second The bottom part.
+     */
+    MatViewVCat(const M1& first, const M2& second) : _first(first), _second(second) {
+        static_assert(type == MatType::NORMAL, "We only support limited matType.");
+        static_assert(_MatShape<M1>::cols == n_cols && _MatShape<M2>::cols == n_cols,
+                      "The parts of a vertical concatenation should have the same column number.");
+        static_assert(_MatShape<M1>::rows + _MatShape<M2>::rows == n_rows, "Matrix dimension should meet.");
+    }
+
+    /// A temporary Mat cannot be a part, since only a view of its data is kept.
+    template <typename T1, size_t rows_, size_t cols_, MatType type_, typename order_>
+    MatViewVCat(Mat<T1, rows_, cols_, type_, order_>&& first, const M2& second) = delete;
+    template <typename T2, size_t rows_, size_t cols_, MatType type_, typename order_>
+    MatViewVCat(const M1& first, Mat<T2, rows_, cols_, type_, order_>&& second) = delete;
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param m Another MatViewVCat object.
+     */
+    MatViewVCat(const MatViewVCat& m) : _first(m._first), _second(m._second) {}
+
+    /**
+     * @brief The data element number.
+     *
+     * @return (constexpr size_t) The size.
+     */
+    inline static constexpr size_t size() noexcept { return n_rows * n_cols; }
+
+    /**
+     * @brief Get the read only data element from row and column index.
+     *
+     * @param r The row index.
+     * @param c The column index.
+     * @return (T) The element value.
+     */
+    T operator()(size_t r, size_t c) const {
+        FLAMES_PRAGMA(INLINE)
+        assert(r < n_rows && "Matrix row index should be within range");
+        assert(c < n_cols && "Matrix col index should be within range");
+        return r < _MatShape<M1>::rows ? _first(r, c) : _second(r - _MatShape<M1>::rows, c);
+    }
+
+    /**
+     * @brief Get the read only element by array row major index.
+     *
+     * @param index The index.
+     * @return (T) The data.
+     */
+    T operator[](size_t index) const { return (*this)(index / n_cols, index % n_cols); }
+
+    /**
+     * @brief Conversion from view to a real Mat.
+     * @return (Mat<T, n_rows, n_cols, MatType::NORMAL>) The real Mat.
+     */
+    operator Mat<T, n_rows, n_cols, MatType::NORMAL>() const {
+        Mat<T, n_rows, n_cols, MatType::NORMAL> mat;
+    MAT_COPY_VCAT:
+        for (size_t r = 0; r != n_rows; ++r) {
+            for (size_t c = 0; c != n_cols; ++c) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+                FLAMES_PRAGMA(LOOP_FLATTEN)
+                mat(r, c) = (*this)(r, c);
+            }
+        }
+        return mat;
+    }
+
+    /**
+     * @brief Explicitly make a Mat copy.
+     *
+     * @return (Mat<T, n_rows, n_cols, MatType::NORMAL>) The real Mat.
+     */
+    Mat<T, n_rows, n_cols, MatType::NORMAL> asMat() const {
+        FLAMES_PRAGMA(INLINE);
+        return static_cast<Mat<T, n_rows, n_cols, MatType::NORMAL>>(*this);
+    }
+
+    void print(const std::string& str = "", std::ostream& os = std::cout) const { this->asMat().print(str, os); }
+
+    /**
+     * @brief Transpose view, i.e. [M1; M2]^T = [M1^T | M2^T].
+     *
+     * @details Every part should have a transpose view `t_()`.
+     * @return (MatViewHCat) The transposed concatenation view.
+     */
+    template <typename P1 = M1, typename P2 = M2>
+    MatViewHCat<T, n_cols, n_rows, MatType::NORMAL, decltype(std::declval<const P1&>().t_()),
+                decltype(std::declval<const P2&>().t_())>
+    t_() const {
+        return { _first.t_(), _second.t_() };
+    }
+
+  public: // original private
+    /// The top part.
+    const M1 _first;
+    /// The bottom part.
+    const M2 _second;
+};
+
+/**
+ * @brief Concatenate two matrices horizontally as a read only view, i.e. [mat_1 | mat_2].
+ *
+ * @details e.g. the augmented matrix [A | b] of a linear system, without copying A and b.
+ * @tparam M1 The first matrix type.
+ * @tparam _unused1 (unused)
+ * @tparam M2 The second matrix type.
+ * @tparam _unused2 (unused)
+ * @tparam T1 The first matrix element type (the element type of the view).
+ * @tparam T2 The second matrix element type.
+ * @tparam type1 The first matrix MatType.
+ * @tparam type2 The second matrix MatType.
+ * @tparam n_rows The row number.
+ * @tparam cols_1 The column number of the left part.
+ * @tparam cols_2 The column number of the right part.
+ * @param mat_1 The left part.
+ * @param mat_2 The right part.
+ * @return (MatViewHCat) The concatenation view.
+ */
+template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+          template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+          typename T2, MatType type1, MatType type2, size_t n_rows, size_t cols_1, size_t cols_2>
+static inline MatViewHCat<T1, n_rows, cols_1 + cols_2, MatType::NORMAL,
+                          typename _CatPart<M1<T1, n_rows, cols_1, type1, _unused1...>>::type,
+                          typename _CatPart<M2<T2, n_rows, cols_2, type2, _unused2...>>::type>
+hcat(const M1<T1, n_rows, cols_1, type1, _unused1...>& mat_1,
+     const M2<T2, n_rows, cols_2, type2, _unused2...>& mat_2) {
+    return { mat_1, mat_2 };
+}
+
+// A temporary Mat cannot be concatenated, since only a view of its data is kept.
+template <typename T1, size_t n_rows, size_t cols_1, MatType type1, typename order1, typename M2>
+static void hcat(Mat<T1, n_rows, cols_1, type1, order1>&& mat_1, const M2& mat_2) = delete;
+template <typename M1, typename T2, size_t n_rows, size_t cols_2, MatType type2, typename order2>
+static void hcat(const M1& mat_1, Mat<T2, n_rows, cols_2, type2, order2>&& mat_2) = delete;
+
+/**
+ * @brief Concatenate two matrices vertically as a read only view, i.e. [mat_1; mat_2].
+ *
+ * @details e.g. the augmented channel matrix [H; √σI] of regularized least squares,
+ *          where √σI can be a SCALAR matrix, without copying H.
+ * @tparam M1 The first matrix type.
+ * @tparam _unused1 (unused)
+ * @tparam M2 The second matrix type.
+ * @tparam _unused2 (unused)
+ * @tparam T1 The first matrix element type (the element type of the view).
+ * @tparam T2 The second matrix element type.
+ * @tparam type1 The first matrix MatType.
+ * @tparam type2 The second matrix MatType.
+ * @tparam n_cols The column number.
+ * @tparam rows_1 The row number of the top part.
+ * @tparam rows_2 The row number of the bottom part.
+ * @param mat_1 The top part.
+ * @param mat_2 The bottom part.
+ * @return (MatViewVCat) The concatenation view.
+ */
+template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+          template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+          typename T2, MatType type1, MatType type2, size_t n_cols, size_t rows_1, size_t rows_2>
+static inline MatViewVCat<T1, rows_1 + rows_2, n_cols, MatType::NORMAL,
+                          typename _CatPart<M1<T1, rows_1, n_cols, type1, _unused1...>>::type,
+                          typename _CatPart<M2<T2, rows_2, n_cols, type2, _unused2...>>::type>
+vcat(const M1<T1, rows_1, n_cols, type1, _unused1...>& mat_1,
+     const M2<T2, rows_2, n_cols, type2, _unused2...>& mat_2) {
+    return { mat_1, mat_2 };
+}
+
+// A temporary Mat cannot be concatenated, since only a view of its data is kept.
+template <typename T1, size_t rows_1, size_t n_cols, MatType type1, typename order1, typename M2>
+static void vcat(Mat<T1, rows_1, n_cols, type1, order1>&& mat_1, const M2& mat_2) = delete;
+template <typename M1, typename T2, size_t rows_2, size_t n_cols, MatType type2, typename order2>
+static void vcat(const M1& mat_1, Mat<T2, rows_2, n_cols, type2, order2>&& mat_2) = delete;
+
+/**
+ * @brief Ping-pong (PIPO) channel of a matrix between two DATAFLOW processes.
+ *
+ * @details The channel holds one buffer. Declare it in the DATAFLOW region and pass it by reference
+ *          to the producer process, which writes it via `writer()` (a MatRef),
+ *          and to the consumer process, which reads it via `reader()` (a MatView).
+ *          HLS then implements the buffer as a PIPO memory of two banks (by default),
+ *          so that the producer fills one bank while the consumer reads the other one
+ *          and consecutive frames overlap, e.g. loading the next channel matrix while computing with the current one.
+ *          More banks are set by `#pragma HLS STREAM variable = <channel> type = pipo depth = <banks>`
+ *          next to the declaration. See `examples/ping-pong` for a DATAFLOW top function.
+ * @note Each process should only access its side of the channel, and the producer should write every element.
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam type Matrix type.
+ * @tparam order Storage order.
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type = MatType::NORMAL,
+          typename order = MATORDER_ROW_MAJOR>
+class MatPingPong {
+  public:
+    using element_type = T;
+    using value_type   = T;
+    using View         = MatView<T, n_rows, n_cols, type, order>;
+    using Ref          = MatRef<T, n_rows, n_cols, type, order>;
+
+    /**
+     * @brief Construct a new MatPingPong object.
+     */
+    MatPingPong() {}
+
+    MatPingPong(const MatPingPong&)            = delete;
+    MatPingPong& operator=(const MatPingPong&) = delete;
+
+    /**
+     * @brief The data element number (of one bank).
+     *
+     * @return (constexpr size_t) The size.
+     */
+    inline static constexpr size_t size() noexcept { return Mat<T, n_rows, n_cols, type, order>::size(); }
+
+    /**
+     * @brief Get the producer side of the channel.
+     *
+     * @return (Ref) The writable reference of the buffer.
+     */
+    inline Ref writer() { return _data.data; }
+
+    /**
+     * @brief Get the consumer side of the channel.
+     *
+     * @return (View) The read only view of the buffer.
+     */
+    inline View reader() const { return _data.data; }
+
+  private:
+    _StorageArray<T, Mat<T, n_rows, n_cols, type, order>::size(), MatStorage<T, n_rows, n_cols, type, order>> _data;
+};
+
+/**
+ * @brief Add two matrices and make a copy.
+ *
+ * @details This will call .add() function.
+ * @note This function makes a copy so it should only by used for initialization.
+ *       Otherwise use .add(Mat_L, mat_R) to avoid the copy operation.
+ * @tparam M1 The left matrix type.
+ * @tparam _unused1 (unused)
+ * @tparam M2 The right matrix type.
+ * @tparam _unused2 (unused)
+ * @tparam T1 The left matrix element type.
+ * @tparam T2 The right matrix element type.
+ * @tparam type1 The left matrix MatType.
+ * @tparam type2 The right matrix MatType.
+ * @tparam order The result storage order (that of the left matrix).
+ * @param mat_L The left matrix.
+ * @param mat_R The right matrix.
+ * @return (Mat<T1, n_rows, n_cols, sumType(type1, type2), order>) The addition result as a copy.
+ */
+template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+          template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+          typename T2, size_t n_rows, size_t n_cols, MatType type1, MatType type2,
+          typename order = ResultOrder<M1<T1, n_rows, n_cols, type1, _unused1...>, sumType(type1, type2)>>
+static inline Mat<T1, n_rows, n_cols, sumType(type1, type2), order>
+operator+(const M1<T1, n_rows, n_cols, type1, _unused1...>& mat_L,
+          const M2<T2, n_rows, n_cols, type2, _unused2...>& mat_R) {
+    FLAMES_PRAGMA(INLINE)
+    Mat<T1, n_rows, n_cols, sumType(type1, type2), order> mat;
+    return mat.add(mat_L, mat_R);
+}
+
+/**
+ * @brief Matrix self plus a matrix.
+ *
+ * @tparam M The right side matrix type.
+ * @tparam _unused (unused)
+ * @tparam T1 The left side matrix element type.
+ * @tparam T2 The right side matrix element type.
+ * @tparam n_rows The number of rows.
+ * @tparam n_cols The number of columns.
+ * @tparam type1 The left side matrix MatType.
+ * @tparam type2 The right side matrix MatType.
+ * @tparam order The left side matrix storage order.
+ * @param mat_L The left side matrix.
+ * @param mat_R The right side matrix.
+ * @return (Mat<T1, n_rows, n_cols, type1, order>&) The addition result (a reference to 'this').
+ */
+template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T1, typename T2,
+          size_t n_rows, size_t n_cols, MatType type1, MatType type2, typename order>
+static inline Mat<T1, n_rows, n_cols, type1, order>& operator+=(Mat<T1, n_rows, n_cols, type1, order>& mat_L,
+                                                                const M<T2, n_rows, n_cols, type2, _unused...>& mat_R) {
+    FLAMES_PRAGMA(INLINE)
+    return mat_L.add(mat_R);
+}
+
+/**
+ * @brief Minus two matrices and make a copy.
+ *
+ * @details This will call .sub() function.
+ * @note This function makes a copy so it should only by used for initialization.
+ *       Otherwise use .sub(Mat_L, mat_R) to avoid the copy operation.
+ * @tparam M1 The left matrix type.
+ * @tparam _unused1 (unused)
+ * @tparam M2 The right matrix type.
+ * @tparam _unused2 (unused)
+ * @tparam T1 The left matrix element type.
+ * @tparam T2 The right matrix element type.
+ * @tparam type1 The left matrix MatType.
+ * @tparam type2 The right matrix MatType.
+ * @tparam order The result storage order (that of the left matrix).
+ * @param mat_L The left matrix.
+ * @param mat_R The right matrix.
+ * @return (Mat<T1, n_rows, n_cols, sumType(type1, type2), order>) The subtract result as a copy.
+ */
+template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+          template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+          typename T2, size_t n_rows, size_t n_cols, MatType type1, MatType type2,
+          typename order = ResultOrder<M1<T1, n_rows, n_cols, type1, _unused1...>, sumType(type1, type2)>>
+static inline Mat<T1, n_rows, n_cols, sumType(type1, type2), order>
 operator-(const M1<T1, n_rows, n_cols, type1, _unused1...>& mat_L,
           const M2<T2, n_rows, n_cols, type2, _unused2...>& mat_R) {
     FLAMES_PRAGMA(INLINE)
-    Mat<T1, n_rows, n_cols, type1> mat;
+    Mat<T1, n_rows, n_cols, sumType(type1, type2), order> mat;
     return mat.sub(mat_L, mat_R);
 }
 
@@ -9292,13 +12458,13 @@ operator-(const M1<T1, n_rows, n_cols, type1, _unused1...>& mat_L,
  * @tparam type2 The right side matrix MatType.
  * @param mat_L The left side matrix.
  * @param mat_R The right side matrix.
- * @return (Mat<T1, n_rows, n_cols, type1>&) The subtract result (a reference to 'this').
+ * @return (M1<T1, n_rows, n_cols, type1, _unused1...>&) The subtract result (a reference to 'this').
  */
 template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
           template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
           typename T2, size_t n_rows, size_t n_cols, MatType type1, MatType type2>
-static inline M1<T1, n_rows, n_cols, type1>& operator-=(M1<T1, n_rows, n_cols, type1, _unused1...>& mat_L,
-                                                        const M2<T2, n_rows, n_cols, type2, _unused2...>& mat_R) {
+static inline M1<T1, n_rows, n_cols, type1, _unused1...>&
+operator-=(M1<T1, n_rows, n_cols, type1, _unused1...>& mat_L, const M2<T2, n_rows, n_cols, type2, _unused2...>& mat_R) {
     FLAMES_PRAGMA(INLINE)
     return mat_L.sub(mat_R);
 }
@@ -9322,12 +12488,12 @@ static inline M1<T1, n_rows, n_cols, type1>& operator-=(M1<T1, n_rows, n_cols, t
  * @return (Mat&) The multiplication result (a reference to 'this').
  */
 template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T1, typename T2,
-          size_t n_rows, size_t n_cols, MatType type1, MatType type2,
+          size_t n_rows, size_t n_cols, MatType type1, MatType type2, typename order,
           std::enable_if_t<(std::is_same<T1, bool>::value), bool> = true>
-static inline Mat<T1, n_rows, n_cols, mulType(type1, type2, n_rows, n_cols, n_cols)>
-operator*=(Mat<T1, n_rows, n_cols, type1>& mat, const M<T2, n_cols, n_cols, type2, _unused...>& mat_R) {
+static inline Mat<T1, n_rows, n_cols, mulType(type1, type2, n_rows, n_cols, n_cols), order>
+operator*=(Mat<T1, n_rows, n_cols, type1, order>& mat, const M<T2, n_cols, n_cols, type2, _unused...>& mat_R) {
     FLAMES_PRAGMA(INLINE)
-    Mat<T2, n_rows, n_cols, mulType(type1, type2, n_rows, n_cols, n_cols)> tmp;
+    Mat<T2, n_rows, n_cols, mulType(type1, type2, n_rows, n_cols, n_cols), order> tmp;
     tmp.mul(mat, mat_R);
     return mat = tmp;
 }
@@ -9343,17 +12509,18 @@ operator*=(Mat<T1, n_rows, n_cols, type1>& mat, const M<T2, n_cols, n_cols, type
  * @tparam n_cols The number of columns.
  * @tparam type1 The left side matrix MatType.
  * @tparam type2 The right side matrix MatType.
+ * @tparam order The left side matrix storage order.
  * @param mat The matrix.
  * @param mat_R The right matrix.
- * @return Mat<T1, n_rows, n_cols, mulType(type1, type2, n_rows, n_cols, n_cols)>
+ * @return Mat<T1, n_rows, n_cols, mulType(type1, type2, n_rows, n_cols, n_cols), order>
  */
 template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T1, typename T2,
-          size_t n_rows, size_t n_cols, MatType type1, MatType type2,
+          size_t n_rows, size_t n_cols, MatType type1, MatType type2, typename order,
           std::enable_if_t<!(std::is_same<T1, bool>::value), bool> = true>
-static inline Mat<T1, n_rows, n_cols, mulType(type1, type2, n_rows, n_cols, n_cols)>
-operator*=(Mat<T1, n_rows, n_cols, type1>& mat, const M<T2, n_cols, n_cols, type2, _unused...>& mat_R) {
+static inline Mat<T1, n_rows, n_cols, mulType(type1, type2, n_rows, n_cols, n_cols), order>
+operator*=(Mat<T1, n_rows, n_cols, type1, order>& mat, const M<T2, n_cols, n_cols, type2, _unused...>& mat_R) {
     FLAMES_PRAGMA(INLINE)
-    Mat<T1, n_rows, n_cols, mulType(type1, type2, n_rows, n_cols, n_cols)> tmp;
+    Mat<T1, n_rows, n_cols, mulType(type1, type2, n_rows, n_cols, n_cols), order> tmp;
     tmp.mul(mat, mat_R);
     return mat = tmp;
 }
@@ -9376,7 +12543,8 @@ operator*=(Mat<T1, n_rows, n_cols, type1>& mat, const M<T2, n_cols, n_cols, type
 template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T,
           typename ScalarT, size_t n_rows, size_t n_cols, MatType type,
           std::enable_if_t<std::is_arithmetic<std::remove_reference_t<ScalarT>>::value, bool> = true>
-static inline Mat<T, n_rows, n_cols, type>& operator*=(const M<T, n_rows, n_cols, type, _unused...>& mat, ScalarT s) {
+static inline M<T, n_rows, n_cols, type, _unused...>& operator*=(M<T, n_rows, n_cols, type, _unused...>& mat,
+                                                                ScalarT s) {
     FLAMES_PRAGMA(INLINE)
     return mat.mul(s);
 }
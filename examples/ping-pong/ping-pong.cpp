@@ -0,0 +1,56 @@
+#include "flames/flames.hpp"
+
+using dtype = FxP<16, 4>;
+using M     = Mat<dtype, 4, 4>;
+using V     = Vec<dtype, 4>;
+using MCh   = MatPingPong<dtype, 4, 4>;
+using VCh   = MatPingPong<dtype, 4, 1>;
+
+// producer: load the channel matrix of this frame
+void load(const dtype A_in[16], MCh& A) {
+    MCh::Ref a = A.writer();
+    for (size_t i = 0; i != 16; ++i) {
+#pragma HLS PIPELINE
+        a[i] = A_in[i];
+    }
+}
+
+// consumer of A and producer of y: y = A * x
+void compute(const MCh& A, const V& x, VCh& y) {
+    V tmp;
+    tmp.mul(A.reader(), x);
+    y.writer() = tmp;
+}
+
+// consumer: store the result of this frame
+void store(const VCh& y, dtype y_out[4]) {
+    const VCh::View v = y.reader();
+    for (size_t i = 0; i != 4; ++i) {
+#pragma HLS PIPELINE
+        y_out[i] = v[i];
+    }
+}
+
+// Each channel is passed by reference from one process to the next one, so HLS makes it a PIPO memory.
+// With ap_ctrl_chain, load of frame k + 1 overlaps compute of frame k and store of frame k - 1.
+void top(const dtype A_in[16], const V& x, dtype y_out[4]) {
+#pragma HLS INTERFACE ap_ctrl_chain port = return
+#pragma HLS DATAFLOW
+    MCh A;
+    VCh y;
+    load(A_in, A);
+    compute(A, x, y);
+    store(y, y_out);
+}
+
+int main() {
+    dtype A_in[16], y_out[4];
+    V     x{ 1, 2, 3, 4 };
+    for (size_t frame = 0; frame != 3; ++frame) {
+        for (size_t i = 0; i != 16; ++i) A_in[i] = dtype(int(i + frame) % 5) / 4;
+        top(A_in, x, y_out);
+        for (size_t i = 0; i != 4; ++i) std::cout << y_out[i] << " ";
+        std::cout << std::endl;
+    }
+    return 0;
+}
@@ -15,9 +15,12 @@
 #define _FLAMES_FLAMES_HPP_
 
 // include all headers of the FLAMES library
+#include "axi.hpp"
 #include "core.hpp"
 #include "sort.hpp"
+#include "stream.hpp"
 #include "tensor.hpp"
+#include "transform.hpp"
 #include "type.hpp"
 
 // use the flames namespace
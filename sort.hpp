@@ -15,43 +15,162 @@
 #ifndef _FLAMES_CORE_HPP_
 #    include "core.hpp"
 #endif
+#include <hls_stream.h>
 
 namespace flames {
 
+template <typename V>
+using _sort_elem_t = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<const V&>()[0])>>;
+
+/**
+ * @brief Comparator for ascending sort.
+ *
+ * @details Only `operator<` of the key type is used, so any signed, fixed-point or floating-point key works.
+ */
+struct SortAscend {
+    template <typename T>
+    inline bool operator()(const T& a, const T& b) const {
+        FLAMES_PRAGMA(INLINE)
+        return a < b;
+    }
+};
+
+/**
+ * @brief Comparator for descending sort.
+ *
+ * @details Only `operator<` of the key type is used, so any signed, fixed-point or floating-point key works.
+ */
+struct SortDescend {
+    template <typename T>
+    inline bool operator()(const T& a, const T& b) const {
+        FLAMES_PRAGMA(INLINE)
+        return b < a;
+    }
+};
+
+/**
+ * @brief The empty payload of a merge sort pass, i.e. nothing is moved along with the keys.
+ */
+struct _SortNoPayload {
+    struct _Elem {
+        template <typename T>
+        inline _Elem& operator=(const T&) {
+            return *this;
+        }
+    };
+    inline _Elem operator[](size_t) const {
+        return _Elem();
+    }
+};
+
+/**
+ * @brief One pass of the merge sort.
+ *
+ * @details Sorted runs of length `width` in `src` are merged pairwise into runs of length `2 * width` in `dst`.
+ *          Keys are ordered by the comparator, and ties are taken from the left run, so the sort is stable.
+ *          The payload (e.g. the indices of argsort) is moved along with the keys.
+ * @tparam size The array size.
+ * @tparam Cmp The comparator type.
+ * @tparam Src The source array type.
+ * @tparam Dst The destination array type.
+ * @tparam SrcP The source payload array type.
+ * @tparam DstP The destination payload array type.
+ * @param src The source array.
+ * @param dst The destination array.
+ * @param width The run length.
+ * @param src_p The source payload array.
+ * @param dst_p The destination payload array.
+ */
+template <size_t size, typename Cmp, typename Src, typename Dst, typename SrcP, typename DstP>
+static void _mergeSortPass(const Src& src, Dst& dst, size_t width, const SrcP& src_p, DstP& dst_p) {
+    FLAMES_PRAGMA(INLINE)
+    size_t f1 = 0;
+    size_t f2 = width;
+    size_t i2 = width;
+    size_t i3 = 2 * width;
+    if (i2 >= size) i2 = size;
+    if (i3 >= size) i3 = size;
+MERGE_ARRAYS:
+    for (size_t i = 0; i != size; ++i) {
+        FLAMES_PRAGMA(PIPELINE II = 1)
+        auto t1 = src[f1];
+        // t2 is not used when the right run is exhausted
+        auto t2 = (f2 == i3) ? t1 : src[f2];
+        if (f2 == i3 || (f1 < i2 && !Cmp()(t2, t1))) {
+            dst[i]   = t1;
+            dst_p[i] = src_p[f1];
+            ++f1;
+        } else {
+            assert(f2 < i3);
+            dst[i]   = t2;
+            dst_p[i] = src_p[f2];
+            ++f2;
+        }
+        if (f1 == i2 && f2 == i3) {
+            f1 = i3;
+            i2 += 2 * width;
+            i3 += 2 * width;
+            if (i2 >= size) i2 = size;
+            if (i3 >= size) i3 = size;
+            f2 = i2;
+        }
+    }
+}
+
+/**
+ * @brief One pass of the (ascending) merge sort without payload.
+ *
+ * @tparam size The array size.
+ * @tparam Src The source array type.
+ * @tparam Dst The destination array type.
+ * @param src The source array.
+ * @param dst The destination array.
+ * @param width The run length.
+ */
+template <size_t size, typename Src, typename Dst>
+static inline void _mergeSortPass(const Src& src, Dst& dst, size_t width) {
+    FLAMES_PRAGMA(INLINE)
+    _SortNoPayload none;
+    _mergeSortPass<size, SortAscend>(src, dst, width, none, none);
+}
+
+/**
+ * @brief The number of merge sort passes, i.e. ceil(log2(size)).
+ *
+ * @param size The array size.
+ * @return (constexpr int) The number of passes.
+ */
+static inline constexpr int _mergeSortPasses(size_t size) {
+    return size <= 1 ? 0 : 1 + _mergeSortPasses((size + 1) / 2);
+}
+
+/**
+ * @brief In-place merge sort (ascending and stable).
+ *
+ * @details The passes alternate between `vec` and a working buffer (ping-pong),
+ *          and the result is copied back only when the number of passes is odd.
+ *          You may configure `FLAMES_SORT_PARTITION_COMPLETE` or `FLAMES_SORT_PARTITION_FACTOR`
+ *          for the partition of the working buffer.
+ * @tparam V The vector type.
+ * @param vec The vector to be sorted.
+ */
 template <typename V>
 static void mergeSort(V& vec) {
     constexpr size_t size = V::size();
     typename V::value_type temp[size];
+#ifdef FLAMES_SORT_PARTITION_COMPLETE
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = temp type = complete)
+#else
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = temp type = block factor = FLAMES_SORT_PARTITION_FACTOR)
+#endif
+    bool in_temp = false;
 MERGE_SORT_STAGE:
-    for (int width = 1; width < size; width *= 2) {
-        int f1 = 0;
-        int f2 = width;
-        int i2 = width;
-        int i3 = 2 * width;
-        if (i2 >= size) i2 = size;
-        if (i3 >= size) i3 = size;
-    MERGE_ARRAYS:
-        for (int i = 0; i < size; ++i) {
-            FLAMES_PRAGMA(PIPELINE II = 1)
-            typename V::value_type t1 = vec[f1];
-            typename V::value_type t2 = (f2 == i3) ? static_cast<typename V::value_type>(0) : vec[f2];
-            if (f2 == i3 || (f1 < i2 && t1 <= t2)) {
-                temp[i] = t1;
-                ++f1;
-            } else {
-                assert(f2 < i3);
-                temp[i] = t2;
-                ++f2;
-            }
-            if (f1 == i2 && f2 == i3) {
-                f1 = i3;
-                i2 += 2 * width;
-                i3 += 2 * width;
-                if (i2 >= size) i2 = size;
-                if (i3 >= size) i3 = size;
-                f2 = i2;
-            }
-        }
+    for (size_t width = 1; width < size; width *= 2) {
+        if (in_temp) _mergeSortPass<size>(temp, vec, width);
+        else _mergeSortPass<size>(vec, temp, width);
+        in_temp = !in_temp;
+    }
+    if (_mergeSortPasses(size) % 2 == 1) {
     MERGE_SORT_COPY:
         for (int i = 0; i < size; ++i) {
             FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
@@ -60,45 +179,797 @@ MERGE_SORT_STAGE:
     }
 }
 
+/**
+ * @brief Merge sort (ascending and stable).
+ *
+ * @details The first pass reads `in`, and the other passes alternate between `out` and a working buffer,
+ *          arranged so that the last pass always writes `out` and no copy is needed.
+ *          You may configure `FLAMES_SORT_PARTITION_COMPLETE` or `FLAMES_SORT_PARTITION_FACTOR`
+ *          for the partition of the working buffer.
+ * @tparam V1 The input vector type.
+ * @tparam V2 The output vector type.
+ * @param in The input vector.
+ * @param out The sorted output vector.
+ */
 template <typename V1, typename V2>
 static void mergeSort(const V1& in, V2& out) {
     constexpr size_t size = V1::size();
     static_assert(size == V2::size(), "Sort in and out vectors/matrices should be of same size.");
     typename V1::value_type temp[size];
-MERGE_SORT_STAGE:
-    for (int width = 1; width < size; width *= 2) {
-        int f1 = 0;
-        int f2 = width;
-        int i2 = width;
-        int i3 = 2 * width;
-        if (i2 >= size) i2 = size;
-        if (i3 >= size) i3 = size;
-    MERGE_ARRAYS:
+#ifdef FLAMES_SORT_PARTITION_COMPLETE
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = temp type = complete)
+#else
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = temp type = block factor = FLAMES_SORT_PARTITION_FACTOR)
+#endif
+    constexpr int n_passes = _mergeSortPasses(size);
+    if (n_passes == 0) {
+    MERGE_SORT_COPY:
         for (int i = 0; i < size; ++i) {
-            FLAMES_PRAGMA(PIPELINE II = 1)
-            typename V1::value_type t1 = in[f1];
-            // TODO: here minimum is zero
-            typename V1::value_type t2 = (f2 == i3) ? static_cast<typename V1::value_type>(0) : in[f2];
-            if (f2 == i3 || (f1 < i2 && t1 <= t2)) {
-                out[i] = t1;
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+            out[i] = in[i];
+        }
+        return;
+    }
+    // the first pass writes out when the number of passes is odd
+    bool in_temp = n_passes % 2 == 0;
+    if (in_temp) _mergeSortPass<size>(in, temp, 1);
+    else _mergeSortPass<size>(in, out, 1);
+MERGE_SORT_STAGE:
+    for (size_t width = 2; width < size; width *= 2) {
+        if (in_temp) _mergeSortPass<size>(temp, out, width);
+        else _mergeSortPass<size>(out, temp, width);
+        in_temp = !in_temp;
+    }
+}
+
+/**
+ * @brief Key/index sort (argsort).
+ *
+ * @details The keys are merge sorted (stably) together with their indices,
+ *          with the passes alternating between two working buffers.
+ *          `index[i]` is the position in `keys` of the i-th key in the sorted order,
+ *          so it can be used directly by `Mat::rows(mat, index)` or `Mat::cols(mat, index)`
+ *          to permute rows or columns.
+ *          You may configure `FLAMES_SORT_PARTITION_COMPLETE` or `FLAMES_SORT_PARTITION_FACTOR`
+ *          for the partition of the working buffers.
+ * @tparam Cmp The comparator type (`SortAscend` or `SortDescend`).
+ * @tparam V1 The key vector type.
+ * @tparam V2 The sorted key vector type.
+ * @tparam V3 The index vector type.
+ * @param keys The keys.
+ * @param sorted The sorted keys.
+ * @param index The indices of the sorted keys.
+ */
+template <typename Cmp = SortAscend, typename V1, typename V2, typename V3>
+static void argSort(const V1& keys, V2& sorted, V3& index) {
+    constexpr size_t size = V1::size();
+    static_assert(size == V2::size(), "Sort in and out vectors/matrices should be of same size.");
+    static_assert(size == V3::size(), "Sort index vector should be of the same size.");
+    using K = _sort_elem_t<V1>;
+    using I = _sort_elem_t<V3>;
+    K key_a[size], key_b[size];
+    I idx_a[size], idx_b[size];
+#ifdef FLAMES_SORT_PARTITION_COMPLETE
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = key_a type = complete)
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = key_b type = complete)
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = idx_a type = complete)
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = idx_b type = complete)
+#else
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = key_a type = block factor = FLAMES_SORT_PARTITION_FACTOR)
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = key_b type = block factor = FLAMES_SORT_PARTITION_FACTOR)
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = idx_a type = block factor = FLAMES_SORT_PARTITION_FACTOR)
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = idx_b type = block factor = FLAMES_SORT_PARTITION_FACTOR)
+#endif
+ARG_SORT_READ:
+    for (size_t i = 0; i != size; ++i) {
+        FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+        key_a[i] = keys[i];
+        idx_a[i] = i;
+    }
+    bool in_b = false;
+ARG_SORT_STAGE:
+    for (size_t width = 1; width < size; width *= 2) {
+        if (in_b) _mergeSortPass<size, Cmp>(key_b, key_a, width, idx_b, idx_a);
+        else _mergeSortPass<size, Cmp>(key_a, key_b, width, idx_a, idx_b);
+        in_b = !in_b;
+    }
+ARG_SORT_WRITE:
+    for (size_t i = 0; i != size; ++i) {
+        FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+        sorted[i] = in_b ? key_b[i] : key_a[i];
+        index[i]  = in_b ? idx_b[i] : idx_a[i];
+    }
+}
+
+/**
+ * @brief Key/index sort (argsort) returning only the indices.
+ *
+ * @tparam Cmp The comparator type (`SortAscend` or `SortDescend`).
+ * @tparam V1 The key vector type.
+ * @tparam V2 The index vector type.
+ * @param keys The keys.
+ * @param index The indices of the sorted keys.
+ */
+template <typename Cmp = SortAscend, typename V1, typename V2>
+static inline void argSort(const V1& keys, V2& index) {
+    Vec<_sort_elem_t<V1>, V1::size()> sorted;
+    argSort<Cmp>(keys, sorted, index);
+}
+
+/**
+ * @brief Key/index sort (argsort) returning an index vector.
+ *
+ * @tparam Cmp The comparator type (`SortAscend` or `SortDescend`).
+ * @tparam I The index type.
+ * @tparam V The key vector type.
+ * @param keys The keys.
+ * @return (Vec<I, V::size()>) The indices of the sorted keys.
+ */
+template <typename Cmp = SortAscend, typename I = size_t, typename V>
+static inline Vec<I, V::size()> argSort(const V& keys) {
+    Vec<I, V::size()> index;
+    argSort<Cmp>(keys, index);
+    return index;
+}
+
+/**
+ * @brief One merge stage of the streaming merge tree.
+ *
+ * @details Runs of length `width` from the input stream are merged pairwise into runs of length `2 * width`.
+ *          Each run pair is buffered in one half of a ping-pong buffer,
+ *          so the merge of one pair overlaps the arrival of the next pair,
+ *          and the stage consumes and produces one element per cycle after a latency of `width` cycles.
+ * @tparam width The input run length.
+ * @tparam T The element type.
+ * @param in The input stream.
+ * @param out The output stream.
+ * @param n The total number of elements (should be a multiple of `2 * width`).
+ */
+template <size_t width, typename T>
+static void _mergeTreeStage(hls::stream<T>& in, hls::stream<T>& out, size_t n) {
+    T run_a[2][width];
+    T run_b[2][width];
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = run_a dim = 1 type = complete)
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = run_b dim = 1 type = complete)
+    assert(n % (2 * width) == 0 && "The stream length should be a multiple of the merged run length.");
+    size_t f1 = 0;
+    size_t f2 = 0;
+MERGE_TREE_STAGE:
+    for (size_t t = 0; t != n + width; ++t) {
+        FLAMES_PRAGMA(PIPELINE II = 1)
+        T in_val;
+        bool in_b     = false;
+        size_t in_pos = 0;
+        if (t < n) {
+            in_val          = in.read();
+            const size_t pp = (t / (2 * width)) % 2;
+            in_pos          = t % (2 * width);
+            if (in_pos < width) {
+                run_a[pp][in_pos] = in_val;
+            } else {
+                in_pos -= width;
+                in_b              = true;
+                run_b[pp][in_pos] = in_val;
+            }
+        }
+        if (t >= width) {
+            const size_t o  = t - width;
+            const size_t pp = (o / (2 * width)) % 2;
+            if (o % (2 * width) == 0) {
+                f1 = 0;
+                f2 = 0;
+            }
+            T t1 = run_a[pp][f1 < width ? f1 : width - 1];
+            // the element of run b may arrive in this very cycle
+            T t2 = (in_b && f2 == in_pos) ? in_val : run_b[pp][f2 < width ? f2 : width - 1];
+            if (f2 == width || (f1 < width && t1 <= t2)) {
+                out.write(t1);
                 ++f1;
             } else {
-                assert(f2 < i3);
-                out[i] = t2;
+                out.write(t2);
                 ++f2;
             }
-            if (f1 == i2 && f2 == i3) {
-                f1 = i3;
-                i2 += 2 * width;
-                i3 += 2 * width;
-                if (i2 >= size) i2 = size;
-                if (i3 >= size) i3 = size;
-                f2 = i2;
+        }
+    }
+}
+
+/**
+ * @brief The merge tree from run length `width` up to N, stage by stage.
+ *
+ * @tparam N The array length.
+ * @tparam width The input run length of the first stage.
+ * @tparam last Whether it is the last stage.
+ */
+template <size_t N, size_t width, bool last = (2 * width >= N)>
+struct _MergeTree {
+    template <typename T>
+    static inline void run(hls::stream<T>& in, hls::stream<T>& out, size_t n) {
+        FLAMES_PRAGMA(INLINE)
+        hls::stream<T> merged;
+        FLAMES_PRAGMA(STREAM variable = merged depth = 2)
+        _mergeTreeStage<width>(in, merged, n);
+        _MergeTree<N, 2 * width>::run(merged, out, n);
+    }
+};
+
+template <size_t N, size_t width>
+struct _MergeTree<N, width, true> {
+    template <typename T>
+    static inline void run(hls::stream<T>& in, hls::stream<T>& out, size_t n) {
+        FLAMES_PRAGMA(INLINE)
+        _mergeTreeStage<width>(in, out, n);
+    }
+};
+
+/**
+ * @brief Streaming merge-tree sort.
+ *
+ * @details The log2(N) merge stages are connected as a dataflow pipeline with FIFOs.
+ *          Each stage sustains one element per cycle,
+ *          so a new array of N elements can be started every N cycles.
+ *          Arrays are read from `in` back to back, and each is written to `out` sorted (ascending and stable).
+ * @tparam N The array length (should be a power of 2).
+ * @tparam T The element type.
+ * @param in The input stream.
+ * @param out The output stream.
+ * @param n_arrays The number of consecutive arrays to be sorted.
+ */
+template <size_t N, typename T>
+static void mergeTreeSort(hls::stream<T>& in, hls::stream<T>& out, size_t n_arrays = 1) {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "The merge tree sort length should be a power of 2.");
+    FLAMES_PRAGMA(DATAFLOW)
+    _MergeTree<N, 1>::run(in, out, n_arrays * N);
+}
+
+template <typename V, typename T>
+static void _vecToStream(const V& vec, hls::stream<T>& s) {
+MERGE_TREE_READ:
+    for (size_t i = 0; i != V::size(); ++i) {
+        FLAMES_PRAGMA(PIPELINE II = 1)
+        s.write(vec[i]);
+    }
+}
+
+template <typename V, typename T>
+static void _streamToVec(hls::stream<T>& s, V& vec) {
+MERGE_TREE_WRITE:
+    for (size_t i = 0; i != V::size(); ++i) {
+        FLAMES_PRAGMA(PIPELINE II = 1)
+        vec[i] = s.read();
+    }
+}
+
+/**
+ * @brief Merge-tree sort of a vector (or matrix data).
+ *
+ * @details The input is streamed through the merge tree of `mergeTreeSort`.
+ * @tparam V1 The input vector type.
+ * @tparam V2 The output vector type.
+ * @param in The input vector.
+ * @param out The output vector.
+ */
+template <typename V1, typename V2>
+static void mergeTreeSort(const V1& in, V2& out) {
+    constexpr size_t size = V1::size();
+    static_assert(size == V2::size(), "Sort in and out vectors/matrices should be of same size.");
+    FLAMES_PRAGMA(DATAFLOW)
+    hls::stream<_sort_elem_t<V1>> s_in, s_out;
+    _vecToStream(in, s_in);
+    mergeTreeSort<size>(s_in, s_out);
+    _streamToVec(s_out, out);
+}
+
+/**
+ * @brief Sorting network kind.
+ *
+ */
+enum class SortNet {
+    BITONIC, /**< Bitonic sorting network. */
+    ODD_EVEN /**< Batcher's odd-even merge sorting network. */
+};
+
+/**
+ * @brief Whether the partner element should be taken in a compare-exchange.
+ *
+ * @details This is the compare/select primitive of the sorting networks.
+ *          Ties keep the own element.
+ * @tparam T The key type.
+ * @param self The own key.
+ * @param other The partner key.
+ * @param keep_min Whether the smaller key should be kept.
+ * @return (bool) Whether to take the partner element.
+ */
+template <typename T>
+static inline bool _takeOther(const T& self, const T& other, bool keep_min) {
+    FLAMES_PRAGMA(INLINE)
+    return keep_min ? other < self : self < other;
+}
+
+/**
+ * @brief Compile-time generated sorting network.
+ *
+ * @details For each stage and each element, `partner` is the index of the element it is compared with
+ *          (itself if idle), and `ascend` tells whether the smaller key goes to the lower index.
+ *          Both networks have log2(N) * (log2(N) + 1) / 2 stages.
+ * @tparam net The sorting network kind.
+ * @tparam N The number of elements (should be a power of 2).
+ */
+template <SortNet net, size_t N>
+struct _SortNetwork {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "The sorting network size should be a power of 2.");
+    static constexpr size_t log2N    = _mergeSortPasses(N);
+    static constexpr size_t n_stages = log2N * (log2N + 1) / 2;
+    size_t partner[n_stages][N];
+    bool ascend[n_stages][N];
+
+    constexpr _SortNetwork() : partner(), ascend() {
+        size_t s = 0;
+        if (net == SortNet::BITONIC) {
+            for (size_t k = 2; k <= N; k *= 2) {
+                for (size_t j = k / 2; j > 0; j /= 2, ++s) {
+                    for (size_t i = 0; i != N; ++i) {
+                        partner[s][i] = i ^ j;
+                        ascend[s][i]  = (i & k) == 0;
+                    }
+                }
+            }
+        } else {
+            for (size_t p = 1; p < N; p *= 2) {
+                for (size_t k = p; k >= 1; k /= 2, ++s) {
+                    for (size_t i = 0; i != N; ++i) {
+                        partner[s][i] = i;
+                        ascend[s][i]  = true;
+                    }
+                    for (size_t j = k % p; j + k < N; j += 2 * k) {
+                        for (size_t i = 0; i < k && i + j + k < N; ++i) {
+                            if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                                partner[s][i + j]     = i + j + k;
+                                partner[s][i + j + k] = i + j;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+/**
+ * @brief Apply the exchanges of one network stage to an array and its payload arrays.
+ *
+ * @tparam N The number of elements.
+ * @param take Whether each element takes its partner element.
+ * @param partner The partner index of each element.
+ */
+template <size_t N>
+static inline void _networkPermute(const bool (&)[N], const size_t (&)[N]) {}
+
+template <size_t N, typename A, typename... As>
+static inline void _networkPermute(const bool (&take)[N], const size_t (&partner)[N], A (&arr)[N], As&... rest) {
+    FLAMES_PRAGMA(INLINE)
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = arr type = complete)
+    A next[N];
+SORT_NETWORK_SELECT:
+    for (size_t i = 0; i != N; ++i) {
+        FLAMES_PRAGMA(UNROLL)
+        next[i] = take[i] ? arr[partner[i]] : arr[i];
+    }
+SORT_NETWORK_UPDATE:
+    for (size_t i = 0; i != N; ++i) {
+        FLAMES_PRAGMA(UNROLL)
+        arr[i] = next[i];
+    }
+    _networkPermute(take, partner, rest...);
+}
+
+/**
+ * @brief Run a compile-time generated compare-exchange network on a key array.
+ *
+ * @details The network is fully unrolled and pipelined with II = 1.
+ *          The stages are grouped by `reg_stages`, and each group is a region of one cycle latency,
+ *          so that the intermediate arrays are registered after every `reg_stages` compare-exchange stages.
+ *          The optional payload arrays (e.g. indices) are permuted along with the keys.
+ * @tparam Network The network table type (e.g. `_SortNetwork` or `_TopKNetwork`).
+ * @tparam reg_stages The number of compare-exchange stages between pipeline registers.
+ * @tparam N The number of elements.
+ * @tparam T The key type.
+ * @tparam P The payload array types.
+ * @param key The keys (permuted in place).
+ * @param payload The payload arrays of N elements (permuted along with the keys).
+ */
+template <typename Network, size_t reg_stages, size_t N, typename T, typename... P>
+static void _runNetwork(T (&key)[N], P&... payload) {
+    static_assert(reg_stages > 0, "There should be at least one stage between pipeline registers.");
+    constexpr Network network{};
+    FLAMES_PRAGMA(PIPELINE II = 1)
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = key type = complete)
+SORT_NETWORK_GROUP:
+    for (size_t g = 0; g < Network::n_stages; g += reg_stages) {
+        FLAMES_PRAGMA(UNROLL)
+        {
+            // a region of one cycle, i.e. the arrays are registered after the group
+            FLAMES_PRAGMA(LATENCY min = 1 max = 1)
+        SORT_NETWORK_STAGE:
+            for (size_t s = g; s != g + reg_stages && s != Network::n_stages; ++s) {
+                FLAMES_PRAGMA(UNROLL)
+                bool take[N];
+            SORT_NETWORK_COMPARE:
+                for (size_t i = 0; i != N; ++i) {
+                    FLAMES_PRAGMA(UNROLL)
+                    const size_t p = network.partner[s][i];
+                    take[i]        = p != i && _takeOther(key[i], key[p], (i < p) == network.ascend[s][i]);
+                }
+                _networkPermute(take, network.partner[s], key, payload...);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Sort with a fully parallel sorting network (ascending).
+ *
+ * @details The network is generated at compile time and is suitable for small sizes (N <= 64).
+ *          It sorts one vector per cycle with a fixed latency.
+ *          You may configure `FLAMES_SORT_NETWORK_REG_STAGES` to set the default number of
+ *          compare-exchange stages between pipeline registers.
+ * @tparam net The sorting network kind (bitonic or odd-even merge).
+ * @tparam reg_stages The number of compare-exchange stages between pipeline registers.
+ * @tparam V1 The input vector type (e.g. Vec, RowVec or MatView).
+ * @tparam V2 The output vector type.
+ * @param in The input vector.
+ * @param out The sorted output vector.
+ */
+template <SortNet net = SortNet::BITONIC, size_t reg_stages = FLAMES_SORT_NETWORK_REG_STAGES, typename V1,
+          typename V2>
+static void sortNetwork(const V1& in, V2& out) {
+    constexpr size_t size = V1::size();
+    static_assert(size == V2::size(), "Sort in and out vectors/matrices should be of same size.");
+    _sort_elem_t<V1> key[size];
+SORT_NETWORK_READ:
+    for (size_t i = 0; i != size; ++i) {
+        FLAMES_PRAGMA(UNROLL)
+        key[i] = in[i];
+    }
+    _runNetwork<_SortNetwork<net, size>, reg_stages>(key);
+SORT_NETWORK_WRITE:
+    for (size_t i = 0; i != size; ++i) {
+        FLAMES_PRAGMA(UNROLL)
+        out[i] = key[i];
+    }
+}
+
+/**
+ * @brief In-place sort with a fully parallel sorting network (ascending).
+ *
+ * @tparam net The sorting network kind (bitonic or odd-even merge).
+ * @tparam reg_stages The number of compare-exchange stages between pipeline registers.
+ * @tparam V The vector type.
+ * @param vec The vector to be sorted.
+ */
+template <SortNet net = SortNet::BITONIC, size_t reg_stages = FLAMES_SORT_NETWORK_REG_STAGES, typename V>
+static inline void sortNetwork(V& vec) {
+    sortNetwork<net, reg_stages>(vec, vec);
+}
+
+/**
+ * @brief Key/index sort with a fully parallel sorting network (ascending).
+ *
+ * @details `index[i]` is the position in `in` of the i-th smallest key.
+ * @tparam net The sorting network kind (bitonic or odd-even merge).
+ * @tparam reg_stages The number of compare-exchange stages between pipeline registers.
+ * @tparam V1 The input key vector type (e.g. Vec, RowVec or MatView).
+ * @tparam V2 The output key vector type.
+ * @tparam V3 The output index vector type.
+ * @param in The input keys.
+ * @param out The sorted keys.
+ * @param index The indices of the sorted keys.
+ */
+template <SortNet net = SortNet::BITONIC, size_t reg_stages = FLAMES_SORT_NETWORK_REG_STAGES, typename V1,
+          typename V2, typename V3>
+static void sortNetwork(const V1& in, V2& out, V3& index) {
+    constexpr size_t size = V1::size();
+    static_assert(size == V2::size(), "Sort in and out vectors/matrices should be of same size.");
+    static_assert(size == V3::size(), "Sort index vector should be of the same size.");
+    _sort_elem_t<V1> key[size];
+    _sort_elem_t<V3> idx[size];
+SORT_NETWORK_READ:
+    for (size_t i = 0; i != size; ++i) {
+        FLAMES_PRAGMA(UNROLL)
+        key[i] = in[i];
+        idx[i] = i;
+    }
+    _runNetwork<_SortNetwork<net, size>, reg_stages>(key, idx);
+SORT_NETWORK_WRITE:
+    for (size_t i = 0; i != size; ++i) {
+        FLAMES_PRAGMA(UNROLL)
+        out[i]   = key[i];
+        index[i] = idx[i];
+    }
+}
+
+/**
+ * @brief The prefetch stage of a k-way merge pass of the external memory sort.
+ *
+ * @details The runs of each group are read by bursts of `burst` elements into one FIFO per run.
+ *          The next burst is fetched for the run whose last fetched element is the smallest (the lowest run on ties),
+ *          i.e. the run that the merge will exhaust first (forecasting),
+ *          so two bursts of FIFO depth per run are enough for the merge never to wait on a full FIFO.
+ * @tparam ways The number of runs merged at a time.
+ * @tparam burst The burst length (in elements).
+ * @tparam T The element type.
+ * @param src The source array (in external memory).
+ * @param runs The FIFOs of the runs.
+ * @param n The number of elements.
+ * @param run The sorted run length in `src`.
+ */
+template <size_t ways, size_t burst, typename T>
+static void _externalMergeFetch(const T* src, hls::stream<T> (&runs)[ways], size_t n, size_t run) {
+    size_t pos[ways], end[ways];
+    T last[ways];
+    bool fetched[ways];
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = pos type = complete)
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = end type = complete)
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = last type = complete)
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = fetched type = complete)
+EXTERNAL_MERGE_FETCH_GROUP:
+    for (size_t base = 0; base < n; base += ways * run) {
+    EXTERNAL_MERGE_FETCH_INIT:
+        for (size_t w = 0; w != ways; ++w) {
+            FLAMES_PRAGMA(UNROLL)
+            const size_t first = base + w * run;
+            pos[w]             = first < n ? first : n;
+            end[w]             = first + run < n ? first + run : n;
+            fetched[w]         = false;
+        }
+        const size_t total = (base + ways * run < n ? base + ways * run : n) - base;
+    EXTERNAL_MERGE_FETCH_BURST:
+        for (size_t f = 0; f != total;) {
+            // the first burst of every run, and then the burst of the run exhausted first by the merge
+            size_t sel = ways;
+        EXTERNAL_MERGE_FORECAST:
+            for (size_t w = 0; w != ways; ++w) {
+                FLAMES_PRAGMA(UNROLL)
+                if (pos[w] != end[w] &&
+                    (sel == ways || (fetched[sel] && (!fetched[w] || last[w] < last[sel])))) {
+                    sel = w;
+                }
+            }
+            assert(sel != ways && "There should be an element left in flames::externalSort.");
+            const size_t first = pos[sel];
+            const size_t len   = end[sel] - first < burst ? end[sel] - first : burst;
+            T val;
+        EXTERNAL_MERGE_BURST_READ:
+            for (size_t i = 0; i != len; ++i) {
+                FLAMES_PRAGMA(PIPELINE II = 1)
+                val = src[first + i];
+            EXTERNAL_MERGE_PUSH:
+                for (size_t w = 0; w != ways; ++w) {
+                    FLAMES_PRAGMA(UNROLL)
+                    if (w == sel) runs[w].write(val);
+                }
             }
+            pos[sel]     = first + len;
+            last[sel]    = val;
+            fetched[sel] = true;
+
+            f += len;
         }
     }
 }
 
+/**
+ * @brief The output stage of a k-way merge pass of the external memory sort.
+ *
+ * @details The heads of the runs are kept in registers, and the smallest one (the lowest run on ties,
+ *          so the merge is stable) is written to `dst` and replaced from its FIFO, one element per cycle.
+ * @tparam ways The number of runs merged at a time.
+ * @tparam T The element type.
+ * @param runs The FIFOs of the runs.
+ * @param dst The destination array (in external memory).
+ * @param n The number of elements.
+ * @param run The sorted run length in the source.
+ */
+template <size_t ways, typename T>
+static void _externalMergeOutput(hls::stream<T> (&runs)[ways], T* dst, size_t n, size_t run) {
+    T head[ways];
+    size_t rem[ways];
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = head type = complete)
+    FLAMES_PRAGMA(ARRAY_PARTITION variable = rem type = complete)
+EXTERNAL_MERGE_GROUP:
+    for (size_t base = 0; base < n; base += ways * run) {
+    EXTERNAL_MERGE_INIT:
+        for (size_t w = 0; w != ways; ++w) {
+            FLAMES_PRAGMA(UNROLL)
+            const size_t first = base + w * run;
+            rem[w]             = first >= n ? 0 : n - first < run ? n - first : run;
+            if (rem[w] != 0) head[w] = runs[w].read();
+        }
+        const size_t total = (base + ways * run < n ? base + ways * run : n) - base;
+    EXTERNAL_MERGE_OUTPUT:
+        for (size_t o = 0; o != total; ++o) {
+            FLAMES_PRAGMA(PIPELINE II = 1)
+            size_t sel = ways;
+            T sel_val;
+        EXTERNAL_MERGE_SELECT:
+            for (size_t w = 0; w != ways; ++w) {
+                FLAMES_PRAGMA(UNROLL)
+                if (rem[w] != 0 && (sel == ways || head[w] < sel_val)) {
+                    sel     = w;
+                    sel_val = head[w];
+                }
+            }
+            assert(sel != ways && "There should be an element left in flames::externalSort.");
+            dst[base + o] = sel_val;
+        EXTERNAL_MERGE_NEXT:
+            for (size_t w = 0; w != ways; ++w) {
+                FLAMES_PRAGMA(UNROLL)
+                if (w == sel && --rem[w] != 0) head[w] = runs[w].read();
+            }
+        }
+    }
+}
+
+/**
+ * @brief One k-way merge pass of the external memory sort.
+ *
+ * @details Each group of `ways` successive sorted runs of length `run` in `src` is merged into one run in `dst`.
+ *          The runs are prefetched by bursts in a separate DATAFLOW process,
+ *          so the output loop is pipelined at II = 1 and written back by bursts as well.
+ * @tparam ways The number of runs merged at a time.
+ * @tparam burst The burst length (in elements).
+ * @tparam T The element type.
+ * @param src The source array (in external memory).
+ * @param dst The destination array (in external memory).
+ * @param n The number of elements.
+ * @param run The sorted run length in `src`.
+ */
+template <size_t ways, size_t burst, typename T>
+static void _externalMergePass(const T* src, T* dst, size_t n, size_t run) {
+    FLAMES_PRAGMA(DATAFLOW)
+    hls::stream<T> runs[ways];
+    FLAMES_PRAGMA(STREAM variable = runs depth = 2 * burst)
+    _externalMergeFetch<ways, burst>(src, runs, n, run);
+    _externalMergeOutput(runs, dst, n, run);
+}
+
+/**
+ * @brief The number of k-way merge passes from runs of length `run` to the whole array.
+ *
+ * @param n The number of elements.
+ * @param run The initial sorted run length.
+ * @param ways The number of runs merged at a time.
+ * @return (size_t) The number of passes.
+ */
+static inline size_t _externalMergePasses(size_t n, size_t run, size_t ways) {
+    size_t n_passes = 0;
+    for (size_t r = run; r < n; r *= ways) ++n_passes;
+    return n_passes;
+}
+
+/**
+ * @brief Sort a run of at most `run_len` elements on chip.
+ *
+ * @details A partial run is padded with copies of its largest element, which stay behind it after sorting.
+ * @tparam run_len The run length.
+ * @tparam T The element type.
+ * @param run The run.
+ * @param len The valid length of the run.
+ */
+template <size_t run_len, typename T>
+static void _externalSortRun(Vec<T, run_len>& run, size_t len) {
+    T max_val = run[0];
+EXTERNAL_SORT_RUN_MAX:
+    for (size_t i = 1; i < len; ++i) {
+        FLAMES_PRAGMA(PIPELINE II = 1)
+        if (max_val < run[i]) max_val = run[i];
+    }
+EXTERNAL_SORT_RUN_PAD:
+    for (size_t i = len; i < run_len; ++i) {
+        FLAMES_PRAGMA(PIPELINE II = 1)
+        run[i] = max_val;
+    }
+    mergeSort(run);
+}
+
+template <typename T>
+static inline T _externalSortRead(const T* src, size_t i) {
+    FLAMES_PRAGMA(INLINE)
+    return src[i];
+}
+
+template <typename T>
+static inline T _externalSortRead(hls::stream<T>& src, size_t) {
+    FLAMES_PRAGMA(INLINE)
+    return src.read();
+}
+
+/**
+ * @brief The run formation and the merge passes of the external memory sort.
+ *
+ * @details Runs of `run_len` elements are read from `src` and sorted on chip with `mergeSort`,
+ *          and then merged `ways` at a time, pass by pass, between `out` and `tmp` in external memory.
+ *          The destination of the run sorting is chosen so that the last pass always writes `out`.
+ * @tparam run_len The on-chip run length.
+ * @tparam ways The number of runs merged at a time.
+ * @tparam burst The burst length (in elements).
+ * @tparam Src The source type (an array in external memory or a stream).
+ * @tparam T The element type.
+ * @param src The source of `n` elements.
+ * @param out The sorted output array (in external memory).
+ * @param tmp The working array of at least `n` elements (in external memory).
+ * @param n The number of elements.
+ */
+template <size_t run_len, size_t ways, size_t burst, typename Src, typename T>
+static void _externalSort(Src& src, T* out, T* tmp, size_t n) {
+    static_assert(ways >= 2, "At least two runs should be merged at a time.");
+    if (n == 0) return;
+    const size_t n_passes = _externalMergePasses(n, run_len, ways);
+    T* run_dst            = n_passes % 2 == 0 ? out : tmp;
+    Vec<T, run_len> run;
+EXTERNAL_SORT_RUN:
+    for (size_t base = 0; base < n; base += run_len) {
+        const size_t len = n - base < run_len ? n - base : run_len;
+    EXTERNAL_SORT_RUN_READ:
+        for (size_t i = 0; i != len; ++i) {
+            FLAMES_PRAGMA(PIPELINE II = 1)
+            run[i] = _externalSortRead(src, base + i);
+        }
+        _externalSortRun(run, len);
+    EXTERNAL_SORT_RUN_WRITE:
+        for (size_t i = 0; i != len; ++i) {
+            FLAMES_PRAGMA(PIPELINE II = 1)
+            run_dst[base + i] = run[i];
+        }
+    }
+    bool in_tmp = n_passes % 2 == 1;
+EXTERNAL_SORT_PASS:
+    for (size_t r = run_len; r < n; r *= ways) {
+        if (in_tmp) _externalMergePass<ways, burst>(tmp, out, n, r);
+        else _externalMergePass<ways, burst>(out, tmp, n, r);
+        in_tmp = !in_tmp;
+    }
+}
+
+/**
+ * @brief Sort a large array in external memory (ascending and stable).
+ *
+ * @details Runs of `run_len` elements are read by bursts and sorted on chip with `mergeSort`,
+ *          and then merged `ways` at a time, pass by pass, between `data` and `tmp` in external memory.
+ *          Only the run buffer and the merge FIFOs (`2 * ways * burst` elements) reside on chip.
+ *          You may configure `FLAMES_SORT_MERGE_WAYS` and `FLAMES_SORT_BURST_LENGTH`
+ *          for the default merge ways and burst length.
+ * @tparam run_len The on-chip run length.
+ * @tparam ways The number of runs merged at a time.
+ * @tparam burst The burst length (in elements).
+ * @tparam T The element type.
+ * @param data The array to be sorted (in external memory).
+ * @param tmp The working array of at least `n` elements (in external memory).
+ * @param n The number of elements.
+ */
+template <size_t run_len, size_t ways = FLAMES_SORT_MERGE_WAYS, size_t burst = FLAMES_SORT_BURST_LENGTH, typename T>
+static void externalSort(T* data, T* tmp, size_t n) {
+    const T* src = data;
+    _externalSort<run_len, ways, burst>(src, data, tmp, n);
+}
+
+/**
+ * @brief Sort a large array from a stream into external memory (ascending and stable).
+ *
+ * @details Same as `externalSort(data, tmp, n)`, but the runs are read from a stream.
+ * @tparam run_len The on-chip run length.
+ * @tparam ways The number of runs merged at a time.
+ * @tparam burst The burst length (in elements).
+ * @tparam T The element type.
+ * @param in The input stream of `n` elements.
+ * @param out The sorted output array (in external memory).
+ * @param tmp The working array of at least `n` elements (in external memory).
+ * @param n The number of elements.
+ */
+template <size_t run_len, size_t ways = FLAMES_SORT_MERGE_WAYS, size_t burst = FLAMES_SORT_BURST_LENGTH, typename T>
+static void externalSort(hls::stream<T>& in, T* out, T* tmp, size_t n) {
+    _externalSort<run_len, ways, burst>(in, out, tmp, n);
+}
+
 template <typename V>
 static inline void sort(V& vec) {
     return mergeSort(vec);
@@ -109,6 +980,141 @@ static inline void sort(const V1& in, V2& out) {
     return mergeSort(in, out);
 }
 
+/**
+ * @brief Compile-time generated top-K tournament network.
+ *
+ * @details The N inputs are split into N / K groups of K.
+ *          Each group is first sorted descending with a bitonic network (skipped if `sorted`).
+ *          Then in each of the log2(N / K) tournament levels, two sorted groups are compared element-wise
+ *          (one in reverse order), keeping the larger K elements as a bitonic sequence,
+ *          which is sorted descending again by a bitonic merge of log2(K) stages.
+ *          The top K elements end up sorted in the first group.
+ *          Both the stage number and the comparator number scale as O(log N * log K).
+ *          Stages are stored as in `_SortNetwork`, with the partner of an element being itself if it is idle.
+ * @tparam N The number of inputs.
+ * @tparam K The number of outputs.
+ * @tparam sorted Whether each group of K inputs is already sorted descending.
+ */
+template <size_t N, size_t K, bool sorted>
+struct _TopKNetwork {
+    static_assert(K >= 1 && (K & (K - 1)) == 0, "The top-K number should be a power of 2.");
+    static_assert(N >= K && N % K == 0 && ((N / K) & (N / K - 1)) == 0,
+                  "The top-K input number should be K times a power of 2.");
+    static constexpr size_t log2K     = _mergeSortPasses(K);
+    static constexpr size_t log2G     = _mergeSortPasses(N / K);
+    static constexpr size_t n_stages_ = (sorted ? 0 : log2K * (log2K + 1) / 2) + log2G * (1 + log2K);
+    static constexpr size_t n_stages  = n_stages_ > 0 ? n_stages_ : 1;
+    size_t partner[n_stages][N];
+    bool ascend[n_stages][N];
+
+    constexpr _TopKNetwork() : partner(), ascend() {
+        for (size_t s = 0; s != n_stages; ++s) {
+            for (size_t i = 0; i != N; ++i) {
+                partner[s][i] = i;
+                ascend[s][i]  = false;
+            }
+        }
+        size_t s = 0;
+        if (!sorted) {
+            // bitonic sort (descending) of each group
+            for (size_t k = 2; k <= K; k *= 2) {
+                for (size_t j = k / 2; j > 0; j /= 2, ++s) {
+                    for (size_t i = 0; i != N; ++i) {
+                        partner[s][i] = i ^ j;
+                        ascend[s][i]  = ((i % K) & k) != 0;
+                    }
+                }
+            }
+        }
+        for (size_t stride = K; stride < N; stride *= 2) {
+            // keep the larger half of two sorted groups as a bitonic sequence in the first group
+            for (size_t g = 0; g < N; g += 2 * stride) {
+                for (size_t i = 0; i != K; ++i) partner[s][g + i] = g + stride + K - 1 - i;
+            }
+            ++s;
+            // bitonic merge (descending) of the first groups
+            for (size_t j = K / 2; j > 0; j /= 2, ++s) {
+                for (size_t g = 0; g < N; g += 2 * stride) {
+                    for (size_t i = 0; i != K; ++i) partner[s][g + i] = g + (i ^ j);
+                }
+            }
+        }
+    }
+};
+
+/**
+ * @brief Top-K selection network with indices.
+ *
+ * @details This generalizes `argmax_4_2` to arbitrary N and K,
+ *          using the same compare/select primitive as the sorting networks.
+ *          The network is generated at compile time, fully unrolled and pipelined with II = 1,
+ *          so a new set of candidates can be processed every cycle with a fixed latency.
+ *          You may configure `FLAMES_SORT_NETWORK_REG_STAGES` to set the default number of
+ *          compare-exchange stages between pipeline registers.
+ * @tparam K The number of outputs (a power of 2).
+ * @tparam sorted Whether each group of K successive inputs is already sorted descending.
+ * @tparam reg_stages The number of compare-exchange stages between pipeline registers.
+ * @tparam V1 The input vector type (of size N, K times a power of 2).
+ * @tparam V2 The input index vector type.
+ * @tparam V3 The output vector type (of size K).
+ * @tparam V4 The output index vector type.
+ * @param in The input values.
+ * @param i_in The input indices.
+ * @param out The K largest values (sorted descending).
+ * @param i_out The indices of the K largest values.
+ */
+template <size_t K, bool sorted = false, size_t reg_stages = FLAMES_SORT_NETWORK_REG_STAGES, typename V1,
+          typename V2, typename V3, typename V4>
+static void topK(const V1& in, const V2& i_in, V3& out, V4& i_out) {
+    constexpr size_t N = V1::size();
+    static_assert(N == V2::size(), "The input index vector should be of the same size as the input.");
+    static_assert(K == V3::size() && K == V4::size(), "The output vectors should be of size K.");
+    _sort_elem_t<V1> key[N];
+    _sort_elem_t<V4> idx[N];
+TOP_K_READ:
+    for (size_t i = 0; i != N; ++i) {
+        FLAMES_PRAGMA(UNROLL)
+        assert((!sorted || i % K == 0 || !(in[i - 1] < in[i])) &&
+               "Should be sorted in groups of K in flames::topK with sorted=true.");
+        key[i] = in[i];
+        idx[i] = i_in[i];
+    }
+    _runNetwork<_TopKNetwork<N, K, sorted>, reg_stages>(key, idx);
+TOP_K_WRITE:
+    for (size_t i = 0; i != K; ++i) {
+        FLAMES_PRAGMA(UNROLL)
+        out[i]   = key[i];
+        i_out[i] = idx[i];
+    }
+}
+
+/**
+ * @brief Top-K selection network.
+ *
+ * @details The indices are the positions in `in`.
+ * @tparam K The number of outputs (a power of 2).
+ * @tparam sorted Whether each group of K successive inputs is already sorted descending.
+ * @tparam reg_stages The number of compare-exchange stages between pipeline registers.
+ * @tparam V1 The input vector type (of size N, K times a power of 2).
+ * @tparam V2 The output vector type (of size K).
+ * @tparam V3 The output index vector type.
+ * @param in The input values.
+ * @param out The K largest values (sorted descending).
+ * @param i_out The indices of the K largest values in `in`.
+ */
+template <size_t K, bool sorted = false, size_t reg_stages = FLAMES_SORT_NETWORK_REG_STAGES, typename V1,
+          typename V2, typename V3>
+static void topK(const V1& in, V2& out, V3& i_out) {
+    constexpr size_t N = V1::size();
+    Vec<_sort_elem_t<V3>, N> i_in;
+TOP_K_INDEX:
+    for (size_t i = 0; i != N; ++i) {
+        FLAMES_PRAGMA(UNROLL)
+        i_in[i] = i;
+    }
+    topK<K, sorted, reg_stages>(in, i_in, out, i_out);
+}
+
 template <typename T, typename I>
 static inline void argmax_4_2(T in1, T in2, T in3, T in4, I i_in1, I i_in2, I i_in3, I i_in4, T& out1, T& out2,
                               I& i_out1, I& i_out2, bool sorted = false) {
@@ -0,0 +1,185 @@
+/**
+ * @file stream.hpp
+ * @author Wuqiong Zhao (me@wqzhao.org), et al.
+ * @brief Stream Operators for FLAMES
+ * @version 0.1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023 Wuqiong Zhao
+ *
+ */
+
+#ifndef _FLAMES_STREAM_HPP_
+#define _FLAMES_STREAM_HPP_
+
+#ifndef _FLAMES_CORE_HPP_
+#    include "core.hpp"
+#endif
+#include <hls_stream.h>
+
+namespace flames {
+
+/**
+ * @brief Matrix plus matrix on streams.
+ *
+ * @details Both operands and the result are streams of n_rows * n_cols elements in the same order
+ *          (e.g. written by `Mat::write`), and one element is produced per cycle.
+ *          Chained stream operators run concurrently in a DATAFLOW region without full-matrix intermediates.
+ * @tparam n_rows The row number.
+ * @tparam n_cols The column number.
+ * @tparam T The result element type.
+ * @tparam T1 The left matrix element type.
+ * @tparam T2 The right matrix element type.
+ * @param in_L The left matrix stream.
+ * @param in_R The right matrix stream.
+ * @param out The result stream.
+ */
+template <size_t n_rows, size_t n_cols, typename T, typename T1, typename T2>
+static void streamAdd(hls::stream<T1>& in_L, hls::stream<T2>& in_R, hls::stream<T>& out) {
+STREAM_PLUS:
+    for (size_t i = 0; i != n_rows * n_cols; ++i) {
+        FLAMES_PRAGMA(PIPELINE II = 1)
+        out.write(_OpBind<MatOp<T>>::add(in_L.read(), in_R.read()));
+    }
+}
+
+/**
+ * @brief Matrix minus matrix on streams.
+ *
+ * @details The stream layout is the same as that of `streamAdd`.
+ * @tparam n_rows The row number.
+ * @tparam n_cols The column number.
+ * @tparam T The result element type.
+ * @tparam T1 The left matrix element type.
+ * @tparam T2 The right matrix element type.
+ * @param in_L The left matrix stream.
+ * @param in_R The right matrix stream.
+ * @param out The result stream.
+ */
+template <size_t n_rows, size_t n_cols, typename T, typename T1, typename T2>
+static void streamSub(hls::stream<T1>& in_L, hls::stream<T2>& in_R, hls::stream<T>& out) {
+STREAM_MINUS:
+    for (size_t i = 0; i != n_rows * n_cols; ++i) {
+        FLAMES_PRAGMA(PIPELINE II = 1)
+        out.write(_OpBind<MatOp<T>>::sub(in_L.read(), in_R.read()));
+    }
+}
+
+/**
+ * @brief Element-wise product of two matrices on streams.
+ *
+ * @details The stream layout is the same as that of `streamAdd`.
+ * @tparam n_rows The row number.
+ * @tparam n_cols The column number.
+ * @tparam T The result element type.
+ * @tparam T1 The left matrix element type.
+ * @tparam T2 The right matrix element type.
+ * @param in_L The left matrix stream.
+ * @param in_R The right matrix stream.
+ * @param out The result stream.
+ */
+template <size_t n_rows, size_t n_cols, typename T, typename T1, typename T2>
+static void streamEmul(hls::stream<T1>& in_L, hls::stream<T2>& in_R, hls::stream<T>& out) {
+STREAM_EMUL:
+    for (size_t i = 0; i != n_rows * n_cols; ++i) {
+        FLAMES_PRAGMA(PIPELINE II = 1)
+        out.write(_OpBind<MatOp<T>>::mul(in_L.read(), in_R.read()));
+    }
+}
+
+/**
+ * @brief Streamed matrix times a resident matrix (or vector), in row order.
+ *
+ * @details The left matrix is read row by row (`MatStreamOrder::ROW`),
+ *          and each row of the result is written as soon as its row of the left matrix arrives,
+ *          so only one row is buffered.
+ *          The result is in row order, which is what a following row-streamed operator needs,
+ *          e.g. a GEMM output feeding a GEMV (a right operand with a single column).
+ * @tparam rows_ The row number of the left matrix.
+ * @tparam T The result element type.
+ * @tparam T1 The left matrix element type.
+ * @tparam M2 The right matrix type.
+ * @tparam _unused2 (unused)
+ * @tparam T2 The right matrix element type.
+ * @tparam comm The common number (the column number of the left matrix and the row number of the right matrix).
+ * @tparam cols_ The column number of the right matrix.
+ * @tparam type2 The right matrix MatType.
+ * @param in_L The left matrix stream (in row order).
+ * @param mat_R The right matrix.
+ * @param out The result stream (in row order).
+ */
+template <size_t rows_, typename T, typename T1, template <class, size_t, size_t, MatType, class...> typename M2,
+          typename... _unused2, typename T2, size_t comm, size_t cols_, MatType type2>
+static void streamMul(hls::stream<T1>& in_L, const M2<T2, comm, cols_, type2, _unused2...>& mat_R,
+                      hls::stream<T>& out) {
+    using Op = _OpBind<MatOp<T>>;
+STREAM_GEMM_ROWS:
+    for (size_t r = 0; r != rows_; ++r) {
+        RowVec<T1, comm> row_L;
+    STREAM_GEMM_ROWS_READ:
+        for (size_t i = 0; i != comm; ++i) {
+            FLAMES_PRAGMA(PIPELINE II = 1)
+            row_L[i] = in_L.read();
+        }
+    STREAM_GEMM_ROWS_c:
+        for (size_t c = 0; c != cols_; ++c) {
+            FLAMES_PRAGMA(PIPELINE II = 1)
+            T sum = T(0);
+            for (size_t i = 0; i != comm; ++i) {
+                FLAMES_PRAGMA(UNROLL)
+                sum = Op::add(sum, Op::mul(row_L[i], mat_R(i, c)));
+            }
+            out.write(sum);
+        }
+    }
+}
+
+/**
+ * @brief A resident matrix times a streamed matrix, in column order.
+ *
+ * @details The right matrix is read column by column (`MatStreamOrder::COL`),
+ *          and each column of the result is written as soon as its column of the right matrix arrives,
+ *          so only one column is buffered.
+ *          The result is in column order.
+ * @tparam cols_ The column number of the right matrix.
+ * @tparam T The result element type.
+ * @tparam M1 The left matrix type.
+ * @tparam _unused1 (unused)
+ * @tparam T1 The left matrix element type.
+ * @tparam rows_ The row number of the left matrix.
+ * @tparam comm The common number (the column number of the left matrix and the row number of the right matrix).
+ * @tparam type1 The left matrix MatType.
+ * @tparam T2 The right matrix element type.
+ * @param mat_L The left matrix.
+ * @param in_R The right matrix stream (in column order).
+ * @param out The result stream (in column order).
+ */
+template <size_t cols_, typename T, template <class, size_t, size_t, MatType, class...> typename M1,
+          typename... _unused1, typename T1, size_t rows_, size_t comm, MatType type1, typename T2>
+static void streamMul(const M1<T1, rows_, comm, type1, _unused1...>& mat_L, hls::stream<T2>& in_R,
+                      hls::stream<T>& out) {
+    using Op = _OpBind<MatOp<T>>;
+STREAM_GEMM_COLS:
+    for (size_t c = 0; c != cols_; ++c) {
+        Vec<T2, comm> col_R;
+    STREAM_GEMM_COLS_READ:
+        for (size_t i = 0; i != comm; ++i) {
+            FLAMES_PRAGMA(PIPELINE II = 1)
+            col_R[i] = in_R.read();
+        }
+    STREAM_GEMM_COLS_r:
+        for (size_t r = 0; r != rows_; ++r) {
+            FLAMES_PRAGMA(PIPELINE II = 1)
+            T sum = T(0);
+            for (size_t i = 0; i != comm; ++i) {
+                FLAMES_PRAGMA(UNROLL)
+                sum = Op::add(sum, Op::mul(mat_L(r, i), col_R[i]));
+            }
+            out.write(sum);
+        }
+    }
+}
+
+} // namespace flames
+
+#endif
@@ -23,20 +23,299 @@
 #endif
 
 namespace flames {
-template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type>
-class Tensor {
-  public:
-    using element_type = T;
-    using value_type   = T;
-    using View         = MatView<T, n_rows, n_cols, type>;
 
-    Tensor() {
+/**
+ * @brief Storage policy of a tensor type.
+ *
+ * @details By default, the partition follows the layout:
+ *          - `TensorLayout::SLICE_MAJOR` uses a block partition of the flattened array;
+ *          - `TensorLayout::INTERLEAVED` uses a cyclic partition of factor n_slices,
+ *            so the same element of all slices can be accessed in one cycle;
+ *          - `TensorLayout::PARTITION_BY_COL` uses a cyclic partition of factor n_cols,
+ *            so that a whole row of a slice can be accessed in one cycle.
+ *          You can set the array partition using macro
+ *          `FLAMES_TENSOR_PARTITION_COMPLETE` to set a complete array partition for all layouts,
+ *          or specialize it (like `MatStorage`) for a specific tensor type.
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam n_slices Number of slices.
+ * @tparam type matrix type.
+ * @tparam layout The data layout policy.
+ */
 #ifdef FLAMES_TENSOR_PARTITION_COMPLETE
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = complete)
+template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type = MatType::NORMAL,
+          TensorLayout layout = TensorLayout::SLICE_MAJOR>
+struct TensorStorage : MatStoragePolicy<MatPartition::COMPLETE> {};
 #else
-        FLAMES_PRAGMA(ARRAY_PARTITION variable = _data type = block factor = FLAMES_MAT_PARTITION_FACTOR)
+template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type = MatType::NORMAL,
+          TensorLayout layout = TensorLayout::SLICE_MAJOR>
+struct TensorStorage
+    : MatStoragePolicy<layout == TensorLayout::SLICE_MAJOR ? MatPartition::BLOCK : MatPartition::CYCLIC,
+                       layout == TensorLayout::INTERLEAVED        ? n_slices
+                       : layout == TensorLayout::PARTITION_BY_COL ? n_cols
+                                                                  : FLAMES_MAT_PARTITION_FACTOR> {};
 #endif
+
+/**
+ * @brief Whether element (r, c) of a matrix type has storage (or mirrors a stored one), i.e. is not always zero.
+ *
+ * @param type The MatType.
+ * @param r The row index.
+ * @param c The column index.
+ * @return (constexpr bool) Whether the element is stored.
+ */
+inline constexpr bool _stridedStored(MatType type, size_t r, size_t c) noexcept {
+    return type == MatType::DIAGONAL || type == MatType::SCALAR ? r == c
+           : type == MatType::UPPER                             ? r <= c
+           : type == MatType::LOWER                             ? r >= c
+           : type == MatType::SUPPER                            ? r < c
+           : type == MatType::SLOWER                            ? r > c
+           : type == MatType::ASYM                              ? r != c
+                                                                : true;
+}
+
+/**
+ * @brief The index in the packed (row major) data array of a stored element (r, c) of a matrix type.
+ *
+ * @details SYM and ASYM elements below the diagonal are mirrored to the stored ones above it.
+ * @tparam n_cols Number of columns.
+ * @tparam type Matrix type.
+ * @param r The row index.
+ * @param c The column index.
+ * @return (constexpr size_t) The packed index.
+ */
+template <size_t n_cols, MatType type>
+inline constexpr size_t _stridedIndex(size_t r, size_t c) noexcept {
+    if (type == MatType::NORMAL) return r * n_cols + c;
+    if (type == MatType::DIAGONAL) return r;
+    if (type == MatType::SCALAR) return 0;
+    if ((type == MatType::SYM || type == MatType::ASYM) && r > c) return _stridedIndex<n_cols, type>(c, r);
+    if (type == MatType::UPPER || type == MatType::SYM) return (2 * n_cols + 1 - r) * r / 2 + c - r;
+    if (type == MatType::SUPPER || type == MatType::ASYM) return (2 * n_cols + 1 - r) * r / 2 + c - 2 * r - 1;
+    if (type == MatType::LOWER) return (1 + r) * r / 2 + c;
+    return (1 + r) * r / 2 + c - r;
+}
+
+/**
+ * @brief Read only view of a matrix whose elements are `stride` apart (e.g. a slice of an interleaved Tensor).
+ *
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam type Matrix type.
+ * @tparam stride The element stride as `std::integral_constant<size_t, ...>`.
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename stride>
+class MatViewStrided {
+  public:
+    /**
+     * @brief Construct a new MatViewStrided object from raw data pointer.
+     *
+     * @param ptr The pointer to the first element.
+     */
+    MatViewStrided(const T* const ptr) : _data(ptr) {}
+
+    /**
+     * @brief The data element number.
+     *
+     * @return (constexpr size_t) The size.
+     */
+    inline static constexpr size_t size() noexcept { return Mat<T, n_rows, n_cols, type>::size(); }
+
+    /**
+     * @brief Get the read only data element from row and column index.
+     *
+     * @param r The row index.
+     * @param c The column index.
+     * @return (T) The element value.
+     */
+    T operator()(size_t r, size_t c) const {
+        FLAMES_PRAGMA(INLINE)
+        assert(r < n_rows && "Matrix row index should be within range");
+        assert(c < n_cols && "Matrix col index should be within range");
+        if (!_stridedStored(type, r, c)) return T(0);
+        const T val = (*this)[_stridedIndex<n_cols, type>(r, c)];
+        return type == MatType::ASYM && r > c ? -val : val;
+    }
+
+    /**
+     * @brief Get the read only element by array row major index.
+     *
+     * @param index The index.
+     * @return (T) The data.
+     */
+    T operator[](size_t index) const {
+        FLAMES_PRAGMA(INLINE)
+        assert(index < size() && "[index] should be in range in MatViewStrided");
+        return _data[_strided(index)];
+    }
+
+    /**
+     * @brief Conversion from view to a real Mat.
+     *
+     * @return (Mat<T, n_rows, n_cols, type>) The real Mat.
+     */
+    operator Mat<T, n_rows, n_cols, type>() const {
+        Mat<T, n_rows, n_cols, type> mat;
+        for (size_t i = 0; i != size(); ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+            mat[i] = (*this)[i];
+        }
+        return mat;
+    }
+
+    /**
+     * @brief Explicitly make a Mat copy.
+     *
+     * @return (Mat<T, n_rows, n_cols, type>) The real Mat.
+     */
+    Mat<T, n_rows, n_cols, type> asMat() const {
+        FLAMES_PRAGMA(INLINE);
+        return static_cast<Mat<T, n_rows, n_cols, type>>(*this);
+    }
+
+    void print(const std::string& str = "", std::ostream& os = std::cout) const { this->asMat().print(str, os); }
+
+  protected:
+    static inline constexpr size_t _strided(size_t index) noexcept { return index * stride::value; }
+
+    const T* const _data;
+};
+
+/**
+ * @brief Writable view of a matrix whose elements are `stride` apart (e.g. a slice of an interleaved Tensor).
+ *
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam type Matrix type.
+ * @tparam stride The element stride as `std::integral_constant<size_t, ...>`.
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type, typename stride>
+class MatRefStrided : public MatViewStrided<T, n_rows, n_cols, type, stride> {
+  public:
+    using Base = MatViewStrided<T, n_rows, n_cols, type, stride>;
+    using Base::operator();
+    using Base::operator[];
+    using Base::size;
+
+    /**
+     * @brief Construct a new MatRefStrided object from raw data pointer.
+     *
+     * @param ptr The pointer to the first element.
+     */
+    MatRefStrided(T* const ptr) : Base(ptr) {}
+
+    /**
+     * @brief Get the writeable element by array row major index.
+     *
+     * @param index The index.
+     * @return (T&) The data.
+     */
+    T& operator[](size_t index) {
+        FLAMES_PRAGMA(INLINE)
+        assert(index < size() && "[index] should be in range in MatRefStrided");
+        return const_cast<T*>(this->_data)[Base::_strided(index)];
+    }
+
+    /**
+     * @brief Get writeable data element by row index and column index.
+     *
+     * @details Only the stored elements can be modified.
+     * @param r The row index (starting from 0).
+     * @param c The column index (staring from 0).
+     * @return (T&) The writeable data element.
+     */
+    T& operator()(size_t r, size_t c) {
+        FLAMES_PRAGMA(INLINE)
+        assert(r < n_rows && "Matrix row index should be within range");
+        assert(c < n_cols && "Matrix col index should be within range");
+        assert(_stridedStored(type, r, c) && type != MatType::SCALAR && !(type == MatType::ASYM && r > c) &&
+               "This element cannot be modified.");
+        return (*this)[_stridedIndex<n_cols, type>(r, c)];
+    }
+
+    /**
+     * @brief Copy a matrix into the view.
+     *
+     * @param m The matrix.
+     * @return (MatRefStrided&) The view (a reference to 'this').
+     */
+    MatRefStrided& operator=(const Mat<T, n_rows, n_cols, type>& m) {
+        for (size_t i = 0; i != size(); ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+            (*this)[i] = m[i];
+        }
+        return *this;
     }
+};
+
+/**
+ * @brief Read only transposed access of a matrix, i.e. `(r, c)` reads `mat(c, r)`.
+ *
+ * @tparam M The matrix type.
+ */
+template <typename M>
+struct _MatTAccess {
+    const M& mat;
+
+    inline auto operator()(size_t r, size_t c) const -> decltype(mat(c, r)) {
+        FLAMES_PRAGMA(INLINE)
+        return mat(c, r);
+    }
+};
+
+/**
+ * @brief Storage order of the mode-3 unfolding of a tensor layout, i.e. the (slices x elements) matrix of the data.
+ *
+ * @tparam layout The data layout policy.
+ */
+template <TensorLayout layout>
+using _TensorUnfoldOrder =
+    std::conditional_t<layout == TensorLayout::INTERLEAVED, MATORDER_COL_MAJOR, MATORDER_ROW_MAJOR>;
+
+/**
+ * @brief Tensor.
+ *
+ * @details The layout policy decides how the slices are stored and partitioned:
+ *          - `TensorLayout::SLICE_MAJOR` (default) stores slices one after another with a block partition;
+ *          - `TensorLayout::INTERLEAVED` stores the same element of all slices together (slice index innermost)
+ *            with each slice in its own bank, so batched kernels can access P slices in one cycle;
+ *          - `TensorLayout::PARTITION_BY_COL` stores slices one after another with each slice partitioned by
+ *            columns, so per-slice kernels can access a whole row in one cycle.
+ *          Slices of slice-major layouts are viewed as `MatView`/`MatRef`,
+ *          while slices of the interleaved layout are viewed as `MatViewStrided`/`MatRefStrided`.
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam n_slices Number of slices.
+ * @tparam type matrix type.
+ * @tparam layout The data layout policy.
+ */
+template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type, TensorLayout layout>
+class Tensor {
+  public:
+    using element_type = T;
+    using value_type   = T;
+    using View         = std::conditional_t<layout == TensorLayout::INTERLEAVED,
+                                    MatViewStrided<T, n_rows, n_cols, type, std::integral_constant<size_t, n_slices>>,
+                                    MatView<T, n_rows, n_cols, type>>;
+    using Ref          = std::conditional_t<layout == TensorLayout::INTERLEAVED,
+                                   MatRefStrided<T, n_rows, n_cols, type, std::integral_constant<size_t, n_slices>>,
+                                   MatRef<T, n_rows, n_cols, type>>;
+    using Slice        = Mat<T, n_rows, n_cols, type>;
+    /// Element-wise maximum of slices (NORMAL for ASYM slices, whose maximum is not anti-symmetric).
+    using MaxSlice = std::conditional_t<type == MatType::ASYM, Mat<T, n_rows, n_cols, MatType::NORMAL>, Slice>;
+
+    Tensor() {}
+
+    /**
+     * @brief Construct a new Tensor object with all elements set to a value.
+     *
+     * @param val The value.
+     */
+    Tensor(T val) { setValue(val); }
 
     inline static constexpr size_t matSize() noexcept {
         return type == MatType::NORMAL     ? n_rows * n_cols
@@ -48,32 +327,683 @@ class Tensor {
                                            : (1 + n_rows) * n_rows / 2;
     }
 
-    inline static constexpr size_t size() noexcept { return n_slices * size(); }
+    inline static constexpr size_t size() noexcept { return n_slices * matSize(); }
+
+    /**
+     * @brief The raw data index of an element of a slice.
+     *
+     * @param s The slice index.
+     * @param i The element index in the slice (as the `operator[]` of Mat).
+     * @return (constexpr size_t) The raw data index.
+     */
+    inline static constexpr size_t index(size_t s, size_t i) noexcept {
+        return layout == TensorLayout::INTERLEAVED ? i * n_slices + s : s * matSize() + i;
+    }
+
+    /**
+     * @brief Get the raw data pointer (of all slices).
+     *
+     * @return (const T*) The pointer.
+     */
+    inline const T* rawDataPtr() const { return _data.data; }
+
+    /**
+     * @brief Get the raw data pointer (of all slices).
+     *
+     * @return (T*) The pointer.
+     */
+    inline T* rawDataPtr() { return _data.data; }
 
     inline View slice(size_t index) const {
         assert(index < n_slices && "Index should be within in range for MatView::slice(index).");
-        return const_cast<T*>(_data + index * matSize());
+        return const_cast<T*>(_data.data + this->index(index, 0));
     }
 
     inline View slice(size_t index) {
         assert(index < n_slices && "Index should be within in range for MatView::slice(index).");
-        return const_cast<T*>(_data + index * matSize());
+        return const_cast<T*>(_data.data + this->index(index, 0));
+    }
+
+    /**
+     * @brief Get a writable view of a slice.
+     *
+     * @param index The slice index.
+     * @return (Ref) The writable slice view.
+     */
+    inline Ref sliceRef(size_t index) {
+        assert(index < n_slices && "Index should be within in range for MatView::sliceRef(index).");
+        return _data.data + this->index(index, 0);
     }
 
     inline View operator[](size_t index) const { return slice(index); }
 
     inline View operator[](size_t index) { return slice(index); }
 
+    /**
+     * @brief Assign a matrix to a slice.
+     *
+     * @details The matrix is copied directly into the slice storage,
+     *          mapping each element by its row and column if the matrix is stored in the other order.
+     *          You may configure `FLAMES_MAT_COPY_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to do the copy in parallel.
+     * @tparam M The matrix type.
+     * @tparam _unused (unused)
+     * @tparam T2 The matrix element type.
+     * @param index The slice index.
+     * @param mat The matrix.
+     * @return (Tensor&) The tensor (a reference to 'this').
+     */
+    template <template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T2>
+    Tensor& setSlice(size_t index, const M<T2, n_rows, n_cols, type, _unused...>& mat) {
+        assert(index < n_slices && "Index should be within in range for Tensor::setSlice(index, mat).");
+    TENSOR_SET_SLICE:
+        for (size_t i = 0; i != matSize(); ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+            _data[this->index(index, i)] = Mat<T, n_rows, n_cols, type>::_at(mat, i);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Set all elements of the tensor to a value.
+     *
+     * @param val The value.
+     */
+    void setValue(T val) {
+    TENSOR_SET_VALUE:
+        for (size_t i = 0; i != size(); ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SET_VALUE_UNROLL_FACTOR)
+            _data[i] = val;
+        }
+    }
+
+    /**
+     * @brief Set all elements of the tensor to zero.
+     *
+     */
+    void setZero() { setValue(static_cast<T>(0)); }
+
+    /**
+     * @brief Tensor plus tensor.
+     *
+     * @details The result is stored to 'this'.
+     *          All slices are processed in one loop.
+     *          You may configure `FLAMES_MAT_PLUS_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing addition in parallel.
+     * @tparam T1 The left tensor element type.
+     * @tparam T2 The right tensor element type.
+     * @param ten_L The left tensor.
+     * @param ten_R The right tensor.
+     * @return (Tensor&) The addition result (a reference to 'this').
+     */
+    template <typename T1, typename T2>
+    Tensor& add(const Tensor<T1, n_rows, n_cols, n_slices, type, layout>& ten_L,
+                const Tensor<T2, n_rows, n_cols, n_slices, type, layout>& ten_R) {
+    TENSOR_PLUS_TENSOR:
+        for (size_t i = 0; i != size(); ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
+            _data[i] = ten_L._data[i] + ten_R._data[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Tensor plus tensor (in place).
+     *
+     * @tparam T2 The right tensor element type.
+     * @param ten_R The right tensor.
+     * @return (Tensor&) The addition result (a reference to 'this').
+     */
+    template <typename T2>
+    Tensor& add(const Tensor<T2, n_rows, n_cols, n_slices, type, layout>& ten_R) {
+        return add(*this, ten_R);
+    }
+
+    /**
+     * @brief Tensor minus tensor.
+     *
+     * @details The result is stored to 'this'.
+     *          All slices are processed in one loop.
+     *          You may configure `FLAMES_MAT_MINUS_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing subtraction in parallel.
+     * @tparam T1 The left tensor element type.
+     * @tparam T2 The right tensor element type.
+     * @param ten_L The left tensor.
+     * @param ten_R The right tensor.
+     * @return (Tensor&) The subtraction result (a reference to 'this').
+     */
+    template <typename T1, typename T2>
+    Tensor& sub(const Tensor<T1, n_rows, n_cols, n_slices, type, layout>& ten_L,
+                const Tensor<T2, n_rows, n_cols, n_slices, type, layout>& ten_R) {
+    TENSOR_MINUS_TENSOR:
+        for (size_t i = 0; i != size(); ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_MINUS_UNROLL_FACTOR)
+            _data[i] = ten_L._data[i] - ten_R._data[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Tensor minus tensor (in place).
+     *
+     * @tparam T2 The right tensor element type.
+     * @param ten_R The right tensor.
+     * @return (Tensor&) The subtraction result (a reference to 'this').
+     */
+    template <typename T2>
+    Tensor& sub(const Tensor<T2, n_rows, n_cols, n_slices, type, layout>& ten_R) {
+        return sub(*this, ten_R);
+    }
+
+    /**
+     * @brief Element-wise multiplication of two tensors.
+     *
+     * @details The result is stored to 'this'.
+     *          All slices are processed in one loop.
+     *          You may configure `FLAMES_MAT_EMUL_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing multiplication in parallel.
+     * @tparam T1 The left tensor element type.
+     * @tparam T2 The right tensor element type.
+     * @param ten_L The left tensor.
+     * @param ten_R The right tensor.
+     * @return (Tensor&) The multiplication result (a reference to 'this').
+     */
+    template <typename T1, typename T2>
+    Tensor& emul(const Tensor<T1, n_rows, n_cols, n_slices, type, layout>& ten_L,
+                 const Tensor<T2, n_rows, n_cols, n_slices, type, layout>& ten_R) {
+    TENSOR_EMUL:
+        for (size_t i = 0; i != size(); ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_EMUL_UNROLL_FACTOR)
+            _data[i] = ten_L._data[i] * ten_R._data[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Element-wise multiplication with a tensor (in place).
+     *
+     * @tparam T2 The right tensor element type.
+     * @param ten_R The right tensor.
+     * @return (Tensor&) The multiplication result (a reference to 'this').
+     */
+    template <typename T2>
+    Tensor& emul(const Tensor<T2, n_rows, n_cols, n_slices, type, layout>& ten_R) {
+        return emul(*this, ten_R);
+    }
+
+    /**
+     * @brief Tensor times a scalar.
+     *
+     * @details The result is stored to 'this'.
+     *          All slices are processed in one loop.
+     *          You may configure `FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing multiplication in parallel.
+     * @tparam T2 The tensor element type.
+     * @tparam ScalarT The scalar type.
+     * @param ten The tensor.
+     * @param s The scalar.
+     * @return (Tensor&) The multiplication result (a reference to 'this').
+     */
+    template <
+        typename T2, typename ScalarT,
+        std::enable_if_t<std::is_arithmetic<std::remove_cv_t<std::remove_reference_t<ScalarT>>>::value, bool> = true>
+    Tensor& mul(const Tensor<T2, n_rows, n_cols, n_slices, type, layout>& ten, ScalarT s) {
+    TENSOR_SCALAR_TIMES:
+        for (size_t i = 0; i != size(); ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_SCALAR_TIMES_UNROLL_FACTOR)
+            _data[i] = ten._data[i] * s;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Tensor times a scalar (in place).
+     *
+     * @tparam ScalarT The scalar type.
+     * @param s The scalar.
+     * @return (Tensor&) The multiplication result (a reference to 'this').
+     */
+    template <
+        typename ScalarT,
+        std::enable_if_t<std::is_arithmetic<std::remove_cv_t<std::remove_reference_t<ScalarT>>>::value, bool> = true>
+    Tensor& mul(ScalarT s) {
+        return mul(*this, s);
+    }
+
+    /**
+     * @brief Sum over the slice axis.
+     *
+     * @details You may configure `FLAMES_MAT_PLUS_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing addition in parallel.
+     * @return (Slice) The sum of all slices.
+     */
+    Slice sliceSum() const {
+        Slice mat;
+    TENSOR_SLICE_SUM:
+        for (size_t s = 0; s != n_slices; ++s) {
+            for (size_t i = 0; i != matSize(); ++i) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
+                if (s == 0) mat[i] = _data[index(0, i)];
+                else mat[i] += _data[index(s, i)];
+            }
+        }
+        return mat;
+    }
+
+    /**
+     * @brief Mean over the slice axis.
+     *
+     * @details You may configure `FLAMES_MAT_PLUS_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing addition in parallel.
+     * @tparam Tp The accumulation type (to avoid overflow before the division).
+     * @return (Slice) The mean of all slices.
+     */
+    template <typename Tp = T>
+    Slice sliceMean() const {
+        Tp acc[matSize()];
+#ifdef FLAMES_TENSOR_PARTITION_COMPLETE
+        FLAMES_PRAGMA(ARRAY_PARTITION variable = acc type = complete)
+#else
+        FLAMES_PRAGMA(ARRAY_PARTITION variable = acc type = block factor = FLAMES_MAT_PARTITION_FACTOR)
+#endif
+        Slice mat;
+    TENSOR_SLICE_MEAN:
+        for (size_t s = 0; s != n_slices; ++s) {
+            for (size_t i = 0; i != matSize(); ++i) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
+                if (s == 0) acc[i] = _data[index(0, i)];
+                else acc[i] += _data[index(s, i)];
+            }
+        }
+    TENSOR_SLICE_MEAN_DIV:
+        for (size_t i = 0; i != matSize(); ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_PLUS_UNROLL_FACTOR)
+            mat[i] = acc[i] / static_cast<int>(n_slices);
+        }
+        return mat;
+    }
+
+    /**
+     * @brief Element-wise maximum over the slice axis.
+     *
+     * @details You may configure `FLAMES_MAT_BOOL_OPER_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing comparison in parallel.
+     *          The maximum of ASYM slices is computed entry by entry into a NORMAL matrix,
+     *          since the lower entries are the negation of the stored ones.
+     * @return (MaxSlice) The element-wise maximum of all slices.
+     */
+    MaxSlice sliceMax() const {
+        MaxSlice mat;
+        if (type == MatType::ASYM) {
+        TENSOR_SLICE_MAX_ASYM:
+            for (size_t s = 0; s != n_slices; ++s) {
+                for (size_t i = 0; i != n_rows * n_cols; ++i) {
+                    FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_BOOL_OPER_UNROLL_FACTOR)
+                    T val = slice(s)(i / n_cols, i % n_cols);
+                    if (s == 0 || mat[i] < val) mat[i] = val;
+                }
+            }
+        } else {
+        TENSOR_SLICE_MAX:
+            for (size_t s = 0; s != n_slices; ++s) {
+                for (size_t i = 0; i != matSize(); ++i) {
+                    FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_BOOL_OPER_UNROLL_FACTOR)
+                    T val = _data[index(s, i)];
+                    if (s == 0 || mat[i] < val) mat[i] = val;
+                }
+            }
+        }
+        return mat;
+    }
+
+    /**
+     * @brief Mode-n product of a tensor and a matrix.
+     *
+     * @details The result is stored to 'this'.
+     *          The modes are numbered from 1 as rows, columns and slices, i.e.
+     *          - mode 1: each result slice is `mat * ten.slice(s)`;
+     *          - mode 2: each result slice is `ten.slice(s) * mat^T`;
+     *          - mode 3: each result slice t is `sum_s mat(t, s) * ten.slice(s)`.
+     *          Mode 1 and mode 2 run the GEMM kernel of Mat on each slice view,
+     *          and mode 3 runs it on the mode-3 unfoldings (slices as rows) viewed in place,
+     *          so the slices are never copied.
+     *          Mode 1 and mode 2 products should be stored in a NORMAL tensor,
+     *          while a mode 3 product keeps the MatType of the slices.
+     *          You may configure `FLAMES_MAT_TIMES_UNROLL_FACTOR`
+     *          or `FLAMES_UNROLL_FACTOR` to doing multiplication in parallel,
+     *          or pass a `Par` policy to override it for this call, e.g. `Y.modeProduct<1, Par<8>>(X, U)`.
+     *          The rows are unrolled unless `ParLoop::COLS` is given.
+     * @tparam mode The mode (1, 2 or 3).
+     * @tparam P The parallelism policy (Par).
+     * @tparam T1 The tensor element type.
+     * @tparam rows_ The number of rows of the tensor.
+     * @tparam cols_ The number of columns of the tensor.
+     * @tparam slices_ The number of slices of the tensor.
+     * @tparam type1 The MatType of the tensor slices.
+     * @tparam layout1 The data layout policy of the tensor.
+     * @tparam M The matrix type.
+     * @tparam _unused (unused)
+     * @tparam T2 The matrix element type.
+     * @tparam mat_rows The number of rows of the matrix.
+     * @tparam mat_cols The number of columns of the matrix (should be the size of the mode).
+     * @tparam type2 The matrix MatType.
+     * @param ten The tensor.
+     * @param mat The matrix.
+     * @return (Tensor&) The mode-n product (a reference to 'this').
+     */
+    template <size_t mode, typename P = Par<FLAMES_MAT_TIMES_UNROLL_FACTOR>, typename T1, size_t rows_, size_t cols_,
+              size_t slices_, MatType type1, TensorLayout layout1,
+              template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T2,
+              size_t mat_rows, size_t mat_cols, MatType type2>
+    Tensor& modeProduct(const Tensor<T1, rows_, cols_, slices_, type1, layout1>& ten,
+                        const M<T2, mat_rows, mat_cols, type2, _unused...>& mat) {
+        FLAMES_PRAGMA(INLINE off)
+        static_assert(IsPar<P>::value, "The policy should be a Par.");
+        static_assert(mode >= 1 && mode <= 3, "The mode of a Tensor should be 1, 2 or 3.");
+        static_assert(mode == 3 || type == MatType::NORMAL, "Mode-1 and mode-2 products should be NORMAL.");
+        static_assert(mode != 3 || type == type1, "Mode-3 product should keep the MatType.");
+        static_assert(mat_cols == (mode == 1 ? rows_ : mode == 2 ? cols_ : slices_), "Matrix dimension should meet.");
+        static_assert(n_rows == (mode == 1 ? mat_rows : rows_), "Tensor dimension should meet.");
+        static_assert(n_cols == (mode == 2 ? mat_rows : cols_), "Tensor dimension should meet.");
+        static_assert(n_slices == (mode == 3 ? mat_rows : slices_), "Tensor dimension should meet.");
+        constexpr bool unroll_cols = P::loop == ParLoop::COLS;
+        if (mode == 1) {
+        TENSOR_MODE_1:
+            for (size_t s = 0; s != n_slices; ++s) {
+                Ref y = sliceRef(s);
+                _gemmAcc<n_rows, n_cols, rows_, P::factor, unroll_cols, T>(y, mat, ten.slice(s));
+            }
+        } else if (mode == 2) {
+            const _MatTAccess<M<T2, mat_rows, mat_cols, type2, _unused...>> mat_t{ mat };
+        TENSOR_MODE_2:
+            for (size_t s = 0; s != n_slices; ++s) {
+                Ref y = sliceRef(s);
+                _gemmAcc<n_rows, n_cols, cols_, P::factor, unroll_cols, T>(y, ten.slice(s), mat_t);
+            }
+        } else {
+            MatRef<T, n_slices, matSize(), MatType::NORMAL, _TensorUnfoldOrder<layout>> y(_data.data);
+            constexpr size_t size1 = Tensor<T1, rows_, cols_, slices_, type1, layout1>::matSize();
+            const MatView<T1, slices_, size1, MatType::NORMAL, _TensorUnfoldOrder<layout1>> x(ten._data.data);
+        TENSOR_MODE_3:
+            _gemmAcc<n_slices, matSize(), slices_, P::factor, unroll_cols, T>(y, mat, x);
+        }
+        return *this;
+    }
+
   private:
-    T _data[type == MatType::NORMAL     ? n_slices * n_rows * n_cols
-            : type == MatType::DIAGONAL ? n_slices * n_rows
-            : type == MatType::SCALAR   ? n_slices * 1
-            : type == MatType::SUPPER   ? n_slices * (n_rows - 1) * n_rows / 2
-            : type == MatType::SLOWER   ? n_slices * (n_rows - 1) * n_rows / 2
-            : type == MatType::ASYM     ? n_slices * (n_rows - 1) * n_rows / 2
-                                        : n_slices * (1 + n_rows) * n_rows / 2];
+    _StorageArray<T, n_slices * matSize(), TensorStorage<T, n_rows, n_cols, n_slices, type, layout>> _data;
+
+    template <typename T_, size_t n_rows_, size_t n_cols_, size_t n_slices_, MatType type_, TensorLayout layout_>
+    friend class Tensor;
 };
 
+/**
+ * @brief Ping-pong (PIPO) channel of a tensor between two DATAFLOW processes.
+ *
+ * @details The channel holds one tensor buffer. Declare it in the DATAFLOW region and pass it by reference
+ *          to the producer process, which writes the slices via `writer(s)`,
+ *          and to the consumer process, which reads the slices via `reader(s)`.
+ *          The slice views are those of the corresponding Tensor layout.
+ *          HLS then implements the buffer as a PIPO memory, as for MatPingPong.
+ * @note Each process should only access its side of the channel, and the producer should write every slice.
+ * @tparam T Element type.
+ * @tparam n_rows Number of rows.
+ * @tparam n_cols Number of columns.
+ * @tparam n_slices Number of slices.
+ * @tparam type matrix type.
+ * @tparam layout The data layout policy.
+ */
+template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type = MatType::NORMAL,
+          TensorLayout layout = TensorLayout::SLICE_MAJOR>
+class TensorPingPong {
+  public:
+    using element_type = T;
+    using value_type   = T;
+    using Ten          = Tensor<T, n_rows, n_cols, n_slices, type, layout>;
+    using View         = typename Ten::View;
+    using Ref          = typename Ten::Ref;
+
+    /**
+     * @brief Construct a new TensorPingPong object.
+     */
+    TensorPingPong() {}
+
+    TensorPingPong(const TensorPingPong&)            = delete;
+    TensorPingPong& operator=(const TensorPingPong&) = delete;
+
+    inline static constexpr size_t size() noexcept { return Ten::size(); }
+
+    /**
+     * @brief Get the producer side of a slice of the channel.
+     *
+     * @param index The slice index.
+     * @return (Ref) The writable slice reference of the buffer.
+     */
+    inline Ref writer(size_t index) {
+        assert(index < n_slices && "Index should be within in range for TensorPingPong::writer(index).");
+        return _data.sliceRef(index);
+    }
+
+    /**
+     * @brief Get the consumer side of a slice of the channel.
+     *
+     * @param index The slice index.
+     * @return (View) The read only slice view of the buffer.
+     */
+    inline View reader(size_t index) const {
+        assert(index < n_slices && "Index should be within in range for TensorPingPong::reader(index).");
+        return _data.slice(index);
+    }
+
+  private:
+    Ten _data;
+};
+
+/**
+ * @brief Tensor plus tensor.
+ *
+ * @tparam T The element type.
+ * @tparam n_rows The number of rows.
+ * @tparam n_cols The number of columns.
+ * @tparam n_slices The number of slices.
+ * @tparam type The MatType of slices.
+ * @tparam layout The data layout policy.
+ * @param ten_L The left tensor.
+ * @param ten_R The right tensor.
+ * @return (Tensor<T, n_rows, n_cols, n_slices, type, layout>) The addition result.
+ */
+template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type, TensorLayout layout>
+static inline Tensor<T, n_rows, n_cols, n_slices, type, layout> operator+(
+    const Tensor<T, n_rows, n_cols, n_slices, type, layout>& ten_L,
+    const Tensor<T, n_rows, n_cols, n_slices, type, layout>& ten_R) {
+    FLAMES_PRAGMA(INLINE)
+    Tensor<T, n_rows, n_cols, n_slices, type, layout> ten;
+    return ten.add(ten_L, ten_R);
+}
+
+/**
+ * @brief Tensor minus tensor.
+ *
+ * @tparam T The element type.
+ * @tparam n_rows The number of rows.
+ * @tparam n_cols The number of columns.
+ * @tparam n_slices The number of slices.
+ * @tparam type The MatType of slices.
+ * @tparam layout The data layout policy.
+ * @param ten_L The left tensor.
+ * @param ten_R The right tensor.
+ * @return (Tensor<T, n_rows, n_cols, n_slices, type, layout>) The subtraction result.
+ */
+template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type, TensorLayout layout>
+static inline Tensor<T, n_rows, n_cols, n_slices, type, layout> operator-(
+    const Tensor<T, n_rows, n_cols, n_slices, type, layout>& ten_L,
+    const Tensor<T, n_rows, n_cols, n_slices, type, layout>& ten_R) {
+    FLAMES_PRAGMA(INLINE)
+    Tensor<T, n_rows, n_cols, n_slices, type, layout> ten;
+    return ten.sub(ten_L, ten_R);
+}
+
+/**
+ * @brief Element-wise multiplication of two tensors.
+ *
+ * @tparam T The element type.
+ * @tparam n_rows The number of rows.
+ * @tparam n_cols The number of columns.
+ * @tparam n_slices The number of slices.
+ * @tparam type The MatType of slices.
+ * @tparam layout The data layout policy.
+ * @param ten_L The left tensor.
+ * @param ten_R The right tensor.
+ * @return (Tensor<T, n_rows, n_cols, n_slices, type, layout>) The multiplication result.
+ */
+template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type, TensorLayout layout>
+static inline Tensor<T, n_rows, n_cols, n_slices, type, layout> operator%(
+    const Tensor<T, n_rows, n_cols, n_slices, type, layout>& ten_L,
+    const Tensor<T, n_rows, n_cols, n_slices, type, layout>& ten_R) {
+    FLAMES_PRAGMA(INLINE)
+    Tensor<T, n_rows, n_cols, n_slices, type, layout> ten;
+    return ten.emul(ten_L, ten_R);
+}
+
+/**
+ * @brief Tensor times a scalar.
+ *
+ * @tparam T The element type.
+ * @tparam n_rows The number of rows.
+ * @tparam n_cols The number of columns.
+ * @tparam n_slices The number of slices.
+ * @tparam type The MatType of slices.
+ * @tparam layout The data layout policy.
+ * @tparam ScalarT The scalar type.
+ * @param ten The tensor.
+ * @param s The scalar.
+ * @return (Tensor<T, n_rows, n_cols, n_slices, type, layout>) The multiplication result.
+ */
+template <typename T, size_t n_rows, size_t n_cols, size_t n_slices, MatType type, TensorLayout layout,
+          typename ScalarT,
+          std::enable_if_t<std::is_arithmetic<std::remove_cv_t<std::remove_reference_t<ScalarT>>>::value, bool> = true>
+static inline Tensor<T, n_rows, n_cols, n_slices, type, layout> operator*(
+    const Tensor<T, n_rows, n_cols, n_slices, type, layout>& ten, ScalarT s) {
+    FLAMES_PRAGMA(INLINE)
+    Tensor<T, n_rows, n_cols, n_slices, type, layout> result;
+    return result.mul(ten, s);
+}
+
+/**
+ * @brief Mode-n product of a tensor and a matrix.
+ *
+ * @details See `Tensor::modeProduct`.
+ * @tparam mode The mode (1, 2 or 3).
+ * @tparam P The parallelism policy (Par).
+ * @tparam T The tensor element type.
+ * @tparam n_rows The number of rows of the tensor.
+ * @tparam n_cols The number of columns of the tensor.
+ * @tparam n_slices The number of slices of the tensor.
+ * @tparam type The MatType of the tensor slices.
+ * @tparam layout The data layout policy.
+ * @tparam M The matrix type.
+ * @tparam _unused (unused)
+ * @tparam T2 The matrix element type.
+ * @tparam mat_rows The number of rows of the matrix.
+ * @tparam mat_cols The number of columns of the matrix (should be the size of the mode).
+ * @tparam type2 The matrix MatType.
+ * @param ten The tensor.
+ * @param mat The matrix.
+ * @return (Tensor) The mode-n product.
+ */
+template <size_t mode, typename P = Par<FLAMES_MAT_TIMES_UNROLL_FACTOR>, typename T, size_t n_rows, size_t n_cols,
+          size_t n_slices, MatType type, TensorLayout layout,
+          template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T2,
+          size_t mat_rows, size_t mat_cols, MatType type2>
+static inline Tensor<T, mode == 1 ? mat_rows : n_rows, mode == 2 ? mat_rows : n_cols,
+                     mode == 3 ? mat_rows : n_slices, mode == 3 ? type : MatType::NORMAL, layout>
+modeProduct(const Tensor<T, n_rows, n_cols, n_slices, type, layout>& ten,
+            const M<T2, mat_rows, mat_cols, type2, _unused...>& mat) {
+    FLAMES_PRAGMA(INLINE)
+    Tensor<T, mode == 1 ? mat_rows : n_rows, mode == 2 ? mat_rows : n_cols, mode == 3 ? mat_rows : n_slices,
+           mode == 3 ? type : MatType::NORMAL, layout>
+        result;
+    result.template modeProduct<mode, P>(ten, mat);
+    return result;
+}
+
+/**
+ * @brief Contraction of a tensor with a vector over the slice index.
+ *
+ * @details The result is `sum_s vec[s] * ten.slice(s)`,
+ *          computed by the GEMM kernel of Mat as the transposed mode-3 unfolding (viewed in place) times `vec`.
+ *          You may configure `FLAMES_MAT_TIMES_UNROLL_FACTOR`
+ *          or `FLAMES_UNROLL_FACTOR` to doing multiplication in parallel,
+ *          or pass a `Par` policy to override it for this call, e.g. `contract<Par<8>>(ten, vec)`.
+ * @tparam P The parallelism policy (Par).
+ * @tparam T The tensor element type.
+ * @tparam n_rows The number of rows of the tensor.
+ * @tparam n_cols The number of columns of the tensor.
+ * @tparam n_slices The number of slices of the tensor.
+ * @tparam type The MatType of the tensor slices.
+ * @tparam layout The data layout policy.
+ * @tparam M The vector type.
+ * @tparam _unused (unused)
+ * @tparam T2 The vector element type.
+ * @tparam type2 The vector MatType.
+ * @param ten The tensor.
+ * @param vec The weight vector.
+ * @return (Mat<T, n_rows, n_cols, type>) The contraction result.
+ */
+template <typename P = Par<FLAMES_MAT_TIMES_UNROLL_FACTOR>, typename T, size_t n_rows, size_t n_cols, size_t n_slices,
+          MatType type, TensorLayout layout, template <class, size_t, size_t, MatType, class...> typename M,
+          typename... _unused, typename T2, MatType type2>
+static Mat<T, n_rows, n_cols, type> contract(const Tensor<T, n_rows, n_cols, n_slices, type, layout>& ten,
+                                             const M<T2, n_slices, 1, type2, _unused...>& vec) {
+    static_assert(IsPar<P>::value, "The policy should be a Par.");
+    using Ten = Tensor<T, n_rows, n_cols, n_slices, type, layout>;
+    Mat<T, n_rows, n_cols, type> result;
+    MatRef<T, Ten::matSize(), 1> y(result.rawDataPtr());
+    const MatView<T, n_slices, Ten::matSize(), MatType::NORMAL, _TensorUnfoldOrder<layout>> x(ten.rawDataPtr());
+    const _MatTAccess<decltype(x)> x_t{ x };
+TENSOR_CONTRACT_VEC:
+    _gemmAcc<Ten::matSize(), 1, n_slices, P::factor, false, T>(y, x_t, vec);
+    return result;
+}
+
+/**
+ * @brief Pairwise contraction of two tensors over the slice index (and the common matrix index).
+ *
+ * @details The result is `sum_s ten_L.slice(s) * ten_R.slice(s)`,
+ *          computed by accumulating the GEMM kernel of Mat over the slice views of both tensors without copying them.
+ *          You may configure `FLAMES_MAT_TIMES_UNROLL_FACTOR`
+ *          or `FLAMES_UNROLL_FACTOR` to doing multiplication in parallel,
+ *          or pass a `Par` policy to override it for this call, e.g. `contract<Par<8>>(ten_L, ten_R)`.
+ *          The rows are unrolled unless `ParLoop::COLS` is given.
+ * @tparam P The parallelism policy (Par).
+ * @tparam T1 The left tensor element type.
+ * @tparam T2 The right tensor element type.
+ * @tparam n_rows The number of rows of the left tensor.
+ * @tparam comm The number of columns of the left tensor (and rows of the right tensor).
+ * @tparam n_cols The number of columns of the right tensor.
+ * @tparam n_slices The number of slices.
+ * @tparam type1 The MatType of the left tensor slices.
+ * @tparam type2 The MatType of the right tensor slices.
+ * @tparam layout1 The data layout policy of the left tensor.
+ * @tparam layout2 The data layout policy of the right tensor.
+ * @param ten_L The left tensor.
+ * @param ten_R The right tensor.
+ * @return (Mat<T1, n_rows, n_cols>) The contraction result.
+ */
+template <typename P = Par<FLAMES_MAT_TIMES_UNROLL_FACTOR>, typename T1, typename T2, size_t n_rows, size_t comm,
+          size_t n_cols, size_t n_slices, MatType type1, MatType type2, TensorLayout layout1, TensorLayout layout2>
+static Mat<T1, n_rows, n_cols> contract(const Tensor<T1, n_rows, comm, n_slices, type1, layout1>& ten_L,
+                                        const Tensor<T2, comm, n_cols, n_slices, type2, layout2>& ten_R) {
+    static_assert(IsPar<P>::value, "The policy should be a Par.");
+    Mat<T1, n_rows, n_cols> result;
+TENSOR_CONTRACT:
+    for (size_t s = 0; s != n_slices; ++s) {
+        _gemmAcc<n_rows, n_cols, comm, P::factor, P::loop == ParLoop::COLS, T1>(result, ten_L.slice(s),
+                                                                                ten_R.slice(s), 0, 0, 0, 0, s == 0);
+    }
+    return result;
+}
+
 } // namespace flames
 
 #endif
@@ -0,0 +1,81 @@
+/**
+ * @file axi-stream.cpp
+ * @brief Test of the AXI4-Stream adapters against the `hls::axis` beat types
+ *
+ * @details Build with the mock header first in the include path, e.g.
+ *          `g++ -std=c++14 -D__VITIS_HLS__ -I mock -I <Vitis HLS include> -I <parent of flames> axi-stream.cpp`.
+ */
+
+#include "flames/flames.hpp"
+
+/**
+ * @brief Store a matrix to a stream, check the side channels and load it back.
+ *
+ * @tparam AxisT The beat type.
+ * @return (bool) Whether the test passes.
+ */
+template <typename AxisT>
+bool testMat() {
+    Mat<ap_int<8>, 3, 3> A, B;
+    for (size_t i = 0; i != A.size(); ++i) A[i] = int(i) * 13 - 50;
+    hls::stream<AxisT> s;
+    storeAxis(A, s);
+    if (s.size() != 3) return false;
+    hls::stream<AxisT> t;
+    for (size_t w = 0; w != 3; ++w) {
+        AxisT beat = s.read();
+        if (bool(beat.last) != (w == 2)) return false;
+        if (int(beat.keep) != (w == 2 ? 1 : 15) || int(beat.strb) != int(beat.keep)) return false;
+        t.write(beat);
+    }
+    if (!loadAxis(B, t, true)) return false;
+    for (size_t i = 0; i != A.size(); ++i)
+        if (A[i] != B[i]) return false;
+    return true;
+}
+
+/**
+ * @brief Check that an early TLAST is reported.
+ *
+ * @tparam AxisT The beat type.
+ * @return (bool) Whether the test passes.
+ */
+template <typename AxisT>
+bool testLength() {
+    Mat<ap_int<8>, 3, 3> A(1), B;
+    hls::stream<AxisT> s, t;
+    storeAxis(A, s);
+    AxisT beat = s.read();
+    beat.last  = 1;
+    t.write(beat);
+    t.write(s.read());
+    t.write(s.read());
+    return !loadAxis(B, t, true);
+}
+
+/**
+ * @brief Store a tensor to a stream and load it back.
+ *
+ * @tparam AxisT The beat type.
+ * @return (bool) Whether the test passes.
+ */
+template <typename AxisT>
+bool testTensor() {
+    Tensor<float, 2, 2, 2, MatType::NORMAL, TensorLayout::INTERLEAVED> X, Y;
+    for (size_t i = 0; i != X.size(); ++i) X.rawDataPtr()[i] = i * 1.5f;
+    hls::stream<AxisT> s;
+    storeAxis(X, s);
+    if (s.size() != 4) return false;
+    loadAxis(Y, s);
+    for (size_t i = 0; i != X.size(); ++i)
+        if (X.rawDataPtr()[i] != Y.rawDataPtr()[i]) return false;
+    return true;
+}
+
+int main() {
+    bool ok = testMat<ap_axiu<32, 0, 0, 0>>() && testMat<ap_axiu<32, 2, 1, 1>>() &&
+              testLength<ap_axiu<32, 0, 0, 0>>() && testLength<ap_axiu<32, 1, 1, 1>>() &&
+              testTensor<ap_axiu<64, 0, 0, 0>>() && testTensor<ap_axiu<64, 4, 0, 0>>();
+    std::cout << (ok ? "PASS" : "FAIL") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file ap_axi_sdata.h
+ * @brief Mock of the Vitis HLS AXI4-Stream side channel header
+ *
+ * @details As in recent Vitis HLS, `ap_axiu` is an alias of `hls::axis` with `size_t` widths,
+ *          and the side channel fields of zero width do not exist.
+ *          Put this directory before the Vitis HLS include directory to use it.
+ */
+
+#ifndef __AP_AXI_SDATA__
+#define __AP_AXI_SDATA__
+
+#include <ap_int.h>
+#include <cstddef>
+
+namespace hls {
+
+template <typename T>
+struct _AxisBytes;
+template <int W>
+struct _AxisBytes<ap_uint<W>> : std::integral_constant<std::size_t, (W + 7) / 8> {};
+
+template <typename T, std::size_t WUser, std::size_t WId, std::size_t WDest>
+struct axis {
+    T data;
+    ap_uint<_AxisBytes<T>::value> keep;
+    ap_uint<_AxisBytes<T>::value> strb;
+    ap_uint<WUser> user;
+    ap_uint<1> last;
+    ap_uint<WId> id;
+    ap_uint<WDest> dest;
+};
+
+template <typename T>
+struct axis<T, 0, 0, 0> {
+    T data;
+    ap_uint<_AxisBytes<T>::value> keep;
+    ap_uint<_AxisBytes<T>::value> strb;
+    ap_uint<1> last;
+};
+
+} // namespace hls
+
+template <std::size_t WData, std::size_t WUser, std::size_t WId, std::size_t WDest>
+using ap_axiu = hls::axis<ap_uint<WData>, WUser, WId, WDest>;
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * @file col-major.cpp
+ * @brief Test of column major matrices in arithmetic, views and mixed order operands
+ *
+ * @details Build with e.g. `g++ -std=c++14 -D__VITIS_HLS__ -I <Vitis HLS include> -I <parent of flames> col-major.cpp`.
+ */
+
+#include "flames/flames.hpp"
+
+template <typename T, size_t n_rows, size_t n_cols, MatType type = MatType::NORMAL>
+using ColMat = Mat<T, n_rows, n_cols, type, MATORDER_COL_MAJOR>;
+
+/**
+ * @brief Whether two matrices have the same elements.
+ *
+ * @tparam M1 The first matrix type.
+ * @tparam _unused1 (unused)
+ * @tparam M2 The second matrix type.
+ * @tparam _unused2 (unused)
+ * @tparam T1 The first matrix element type.
+ * @tparam T2 The second matrix element type.
+ * @tparam n_rows The number of rows.
+ * @tparam n_cols The number of columns.
+ * @tparam type1 The first matrix MatType.
+ * @tparam type2 The second matrix MatType.
+ * @param a The first matrix.
+ * @param b The second matrix.
+ * @return (bool) Whether they are equal element by element.
+ */
+template <template <class, size_t, size_t, MatType, class...> typename M1, typename... _unused1,
+          template <class, size_t, size_t, MatType, class...> typename M2, typename... _unused2, typename T1,
+          typename T2, size_t n_rows, size_t n_cols, MatType type1, MatType type2>
+bool same(const M1<T1, n_rows, n_cols, type1, _unused1...>& a, const M2<T2, n_rows, n_cols, type2, _unused2...>& b) {
+    for (size_t r = 0; r != n_rows; ++r)
+        for (size_t c = 0; c != n_cols; ++c)
+            if (a(r, c) != b(r, c)) return false;
+    return true;
+}
+
+/**
+ * @brief Fill the stored elements of a row major matrix with distinct values.
+ *
+ * @tparam T The element type.
+ * @tparam n_rows The number of rows.
+ * @tparam n_cols The number of columns.
+ * @tparam type The MatType.
+ * @param m The matrix.
+ * @param seed The seed of the values.
+ */
+template <typename T, size_t n_rows, size_t n_cols, MatType type>
+void fill(Mat<T, n_rows, n_cols, type>& m, int seed) {
+    for (size_t i = 0; i != m.size(); ++i) m[i] = int(i * 7) % 11 - 5 + seed;
+}
+
+/**
+ * @brief Check a product through every parallelism policy for one combination of storage orders.
+ *
+ * @tparam C The result matrix type.
+ * @tparam L The left matrix type.
+ * @tparam R The right matrix type.
+ * @tparam E The expected result type.
+ * @param mat_L The left matrix.
+ * @param mat_R The right matrix.
+ * @param expected The expected result.
+ * @return (bool) Whether every product equals the expected result.
+ */
+template <typename C, typename L, typename R, typename E>
+bool mulPar(const L& mat_L, const R& mat_R, const E& expected) {
+    C c;
+    bool ok = same(c.mul(mat_L, mat_R), expected);
+    ok &= same(c.template mul<Par<2>>(mat_L, mat_R), expected);
+    ok &= same(c.template mul<Par<2, ParLoop::ROWS>>(mat_L, mat_R), expected);
+    ok &= same(c.template mul<Par<2, ParLoop::COLS>>(mat_L, mat_R), expected);
+    return ok;
+}
+
+int main() {
+    bool ok = true;
+    // column major NORMAL arithmetic
+    Mat<int, 3, 4> A, B;
+    ColMat<int, 3, 4> Ac, Bc;
+    fill(A, 1);
+    fill(B, 2);
+    Ac = ColMat<int, 3, 4>(A);
+    Bc = ColMat<int, 3, 4>(B);
+    ok &= same(Ac, A) && same(Bc, B);
+    ok &= same(Ac + Bc, A + B);
+    ok &= same(Ac - Bc, A - B);
+    ok &= same(Ac % Bc, A % B);
+    ok &= same(Ac * 2, A * 2);
+    ok &= same(2 * Ac, 2 * A);
+    ok &= same(-Ac, -A);
+    ok &= same(Ac + B, A + B) && same(A - Bc, A - B) && same(Ac % B, A % B);
+    ColMat<int, 3, 4> Cc = Ac;
+    Cc += Bc;
+    ok &= same(Cc, A + B);
+    Cc -= B;
+    ok &= same(Cc, A);
+    Cc *= 3;
+    ok &= same(Cc, A * 3);
+    Mat<int, 3, 4> C = A;
+    C += Bc;
+    ok &= same(C, A + B);
+
+    // products with every order combination
+    Mat<int, 4, 2> D;
+    ColMat<int, 4, 2> Dc;
+    fill(D, 3);
+    Dc = ColMat<int, 4, 2>(D);
+    const Mat<int, 3, 2> P = A * D;
+    ok &= same(Ac * Dc, P) && same(Ac * D, P) && same(A * Dc, P);
+    ColMat<int, 3, 2> Pc;
+    ok &= same(Pc.mul(A, D), P) && same(Pc.mul(Ac, Dc), P) && same(Pc.mul(Ac, D), P) && same(Pc.mul(A, Dc), P);
+    ok &= mulPar<Mat<int, 3, 2>>(A, D, P) && mulPar<Mat<int, 3, 2>>(A, Dc, P);
+    ok &= mulPar<Mat<int, 3, 2>>(Ac, D, P) && mulPar<Mat<int, 3, 2>>(Ac, Dc, P);
+    ok &= mulPar<ColMat<int, 3, 2>>(A, D, P) && mulPar<ColMat<int, 3, 2>>(A, Dc, P);
+    ok &= mulPar<ColMat<int, 3, 2>>(Ac, D, P) && mulPar<ColMat<int, 3, 2>>(Ac, Dc, P);
+    // the unrolled loop follows the operands (rows for column major L, columns for row major R), then the result
+    static_assert(!_gemmUnrollCols<Mat<int, 3, 2>, ColMat<int, 3, 4>, ColMat<int, 4, 2>>(), "");
+    static_assert(!_gemmUnrollCols<ColMat<int, 3, 2>, ColMat<int, 3, 4>, ColMat<int, 4, 2>>(), "");
+    static_assert(_gemmUnrollCols<Mat<int, 3, 2>, Mat<int, 3, 4>, Mat<int, 4, 2>>(), "");
+    static_assert(_gemmUnrollCols<ColMat<int, 3, 2>, Mat<int, 3, 4>, Mat<int, 4, 2>>(), "");
+    static_assert(!_gemmUnrollCols<Mat<int, 3, 2>, Mat<int, 3, 4>, ColMat<int, 4, 2>>(), "");
+    static_assert(_gemmUnrollCols<ColMat<int, 3, 2>, ColMat<int, 3, 4>, Mat<int, 4, 2>>(), "");
+
+    // views of a column major matrix
+    ok &= same(Ac.t(), A.t()) && same(Ac.t_(), A.t_());
+    ok &= same(Ac.opp_(), -A);
+    ok &= same(Mat<int, 3, 1>(Ac.col_(2)), Mat<int, 3, 1>(A.col_(2)));
+    ok &= same(Mat<int, 2, 4>(Ac.Rows_<1, 2>()), Mat<int, 2, 4>(A.Rows_<1, 2>()));
+    ok &= same(Mat<int, 3, 3>(Ac.Cols_<1, 3>()), Mat<int, 3, 3>(A.Cols_<1, 3>()));
+    ColMat<int, 3, 3> Sc;
+    Mat<int, 3, 3> S;
+    fill(S, 4);
+    Sc = ColMat<int, 3, 3>(S);
+    ok &= same(Sc.diagMat_(), S.diagMat_()) && same(Sc.offDiag_(), S.offDiag_());
+    ok &= same(Sc * Sc, S * S);
+
+    // column major triangular matrices (the UPPER products are laid out for 8 x 8)
+    Mat<int, 8, 8, MatType::UPPER> U;
+    ColMat<int, 8, 8, MatType::UPPER> Uc;
+    fill(U, 5);
+    Uc = ColMat<int, 8, 8, MatType::UPPER>(U);
+    ok &= same(Uc, U) && same(Uc + Uc, U + U) && same(Uc - U, U - U) && same(Uc * 2, U * 2) && same(-Uc, -U);
+    Mat<int, 8, 8> W;
+    ColMat<int, 8, 8> Wc;
+    fill(W, 6);
+    Wc = ColMat<int, 8, 8>(W);
+    ok &= same(Uc * Wc, U * W) && same(Wc * Uc, W * U);
+
+    // column major slices of a tensor
+    Tensor<int, 3, 4, 2> Ts;
+    Tensor<int, 3, 4, 2, MatType::NORMAL, TensorLayout::INTERLEAVED> Ti;
+    Ts.setSlice(0, Ac).setSlice(1, B);
+    Ti.setSlice(0, Ac).setSlice(1, Bc);
+    ok &= same(Ts.slice(0), A) && same(Ts.slice(1), B) && same(Ti.slice(0), A) && same(Ti.slice(1), B);
+
+    std::cout << (ok ? "PASS" : "FAIL") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file tensor.cpp
+ * @brief Test of the slice reductions of Tensor
+ *
+ * @details Build with e.g. `g++ -std=c++14 -D__VITIS_HLS__ -I <Vitis HLS include> -I <parent of flames> tensor.cpp`.
+ */
+
+#include "flames/flames.hpp"
+
+/**
+ * @brief Check the element-wise maximum of two ASYM slices.
+ *
+ * @tparam layout The data layout policy.
+ * @return (bool) Whether the test passes.
+ */
+template <TensorLayout layout>
+bool testAsymMax() {
+    Tensor<int, 3, 3, 2, MatType::ASYM, layout> X;
+    X.setSlice(0, Mat<int, 3, 3, MatType::ASYM>{ 1, 2, 3 });
+    X.setSlice(1, Mat<int, 3, 3, MatType::ASYM>{ 5, -4, 0 });
+    const Mat<int, 3, 3> M = X.sliceMax();
+    bool ok = true;
+    for (size_t r = 0; r != 3; ++r)
+        for (size_t c = 0; c != 3; ++c) {
+            const int a = X.slice(0)(r, c), b = X.slice(1)(r, c);
+            ok &= M(r, c) == (a < b ? b : a);
+        }
+    return ok && M(1, 0) == -1 && M(2, 0) == 4;
+}
+
+/**
+ * @brief Check the element-wise maximum of two NORMAL slices.
+ *
+ * @tparam layout The data layout policy.
+ * @return (bool) Whether the test passes.
+ */
+template <TensorLayout layout>
+bool testNormalMax() {
+    Tensor<int, 2, 3, 3, MatType::NORMAL, layout> X;
+    for (size_t s = 0; s != 3; ++s)
+        for (size_t i = 0; i != 6; ++i) X.sliceRef(s)[i] = int(i * 5 + s * 7) % 9 - 4;
+    const Mat<int, 2, 3> M = X.sliceMax();
+    bool ok = true;
+    for (size_t i = 0; i != 6; ++i) {
+        int m = X.slice(0)[i];
+        for (size_t s = 1; s != 3; ++s)
+            if (m < X.slice(s)[i]) m = X.slice(s)[i];
+        ok &= M[i] == m;
+    }
+    return ok;
+}
+
+int main() {
+    bool ok = true;
+    ok &= testAsymMax<TensorLayout::SLICE_MAJOR>() && testAsymMax<TensorLayout::INTERLEAVED>();
+    ok &= testNormalMax<TensorLayout::SLICE_MAJOR>() && testNormalMax<TensorLayout::INTERLEAVED>();
+    std::cout << (ok ? "PASS" : "FAIL") << std::endl;
+    return ok ? 0 : 1;
+}
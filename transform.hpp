@@ -0,0 +1,273 @@
+/**
+ * @file transform.hpp
+ * @author Wuqiong Zhao (me@wqzhao.org), et al.
+ * @brief Structured Transforms for FLAMES
+ * @version 0.1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023 Wuqiong Zhao
+ *
+ */
+
+#ifndef _FLAMES_TRANSFORM_HPP_
+#define _FLAMES_TRANSFORM_HPP_
+
+#ifndef _FLAMES_CORE_HPP_
+#    include "core.hpp"
+#endif
+
+namespace flames {
+
+/**
+ * @brief In-place fast Walsh-Hadamard transform.
+ *
+ * @details The (unnormalized) Sylvester-Hadamard matrix H_N is applied to the vector,
+ *          i.e. `vec = H_N * vec`, using log2(N) butterfly stages of N additions/subtractions,
+ *          instead of the N^2 multiply-accumulate operations of a dense matrix product.
+ *          Since H_{N1} ⊗ H_{N2} = H_{N1 N2}, this also covers the Kronecker product of Hadamard factors.
+ *          You may configure `FLAMES_MAT_FWHT_UNROLL_FACTOR`
+ *          or `FLAMES_UNROLL_FACTOR` to set the number of parallel butterflies in a stage.
+ * @tparam V The vector type (with a power of 2 size).
+ * @param vec The vector to be transformed.
+ */
+template <typename V>
+static void fwht(V& vec) {
+    constexpr size_t N = V::size();
+    static_assert(N > 0 && (N & (N - 1)) == 0, "The FWHT length should be a power of 2.");
+FWHT_STAGE:
+    for (size_t h = 1; h < N; h *= 2) {
+    FWHT_BUTTERFLY:
+        for (size_t i = 0; i != N / 2; ++i) {
+            FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_FWHT_UNROLL_FACTOR)
+            const size_t j                = (i / h) * 2 * h + i % h;
+            typename V::value_type top    = vec[j];
+            typename V::value_type bottom = vec[j + h];
+            vec[j]                        = top + bottom;
+            vec[j + h]                    = top - bottom;
+        }
+    }
+}
+
+/**
+ * @brief Fast Walsh-Hadamard transform.
+ *
+ * @details The input is first copied to the output, and then transformed in place.
+ * @tparam V1 The input vector type.
+ * @tparam V2 The output vector type (with a power of 2 size).
+ * @param in The input vector.
+ * @param out The output vector.
+ */
+template <typename V1, typename V2>
+static void fwht(const V1& in, V2& out) {
+    static_assert(V1::size() == V2::size(), "The input and output sizes of FWHT should be the same.");
+FWHT_COPY:
+    for (size_t i = 0; i != V2::size(); ++i) {
+        FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+        out[i] = in[i];
+    }
+    fwht(out);
+}
+
+/**
+ * @brief Kronecker product of two matrices, stored only by its factors.
+ *
+ * @details The product `A ⊗ B` is of size (rows_L * rows_R) x (cols_L * cols_R),
+ *          but only the two factors are stored.
+ *          Multiplying it with a matrix (or vector) applies the factors in sequence,
+ *          based on `(A ⊗ B) vec(X) = vec(A X B^T)` (with row major vectorization),
+ *          which costs cols_L * rows_R * (cols_R + rows_L) multiplications per column
+ *          instead of rows_L * rows_R * cols_L * cols_R for the dense product.
+ * @tparam T Element type.
+ * @tparam rows_L The number of rows of the left factor.
+ * @tparam cols_L The number of columns of the left factor.
+ * @tparam type_L The MatType of the left factor.
+ * @tparam rows_R The number of rows of the right factor.
+ * @tparam cols_R The number of columns of the right factor.
+ * @tparam type_R The MatType of the right factor.
+ */
+template <typename T, size_t rows_L, size_t cols_L, MatType type_L, size_t rows_R, size_t cols_R, MatType type_R>
+class MatKron {
+  public:
+    using element_type = T;
+    using value_type   = T;
+    using FactorL      = Mat<T, rows_L, cols_L, type_L>;
+    using FactorR      = Mat<T, rows_R, cols_R, type_R>;
+
+    /**
+     * @brief Construct a new MatKron object from the two factors.
+     *
+     * @param mat_L The left factor.
+     * @param mat_R The right factor.
+     */
+    MatKron(const FactorL& mat_L, const FactorR& mat_R) : _L(mat_L), _R(mat_R) {}
+
+    /**
+     * @brief The number of rows of the Kronecker product.
+     *
+     * @return (constexpr size_t) The row number.
+     */
+    inline static constexpr size_t rows() noexcept { return rows_L * rows_R; }
+
+    /**
+     * @brief The number of columns of the Kronecker product.
+     *
+     * @return (constexpr size_t) The column number.
+     */
+    inline static constexpr size_t cols() noexcept { return cols_L * cols_R; }
+
+    /**
+     * @brief The stored data element number (of both factors).
+     *
+     * @return (constexpr size_t) The size.
+     */
+    inline static constexpr size_t size() noexcept { return FactorL::size() + FactorR::size(); }
+
+    /**
+     * @brief Get the left factor.
+     *
+     * @return (const FactorL&) The left factor.
+     */
+    inline const FactorL& factorL() const { return _L; }
+
+    /**
+     * @brief Get the right factor.
+     *
+     * @return (const FactorR&) The right factor.
+     */
+    inline const FactorR& factorR() const { return _R; }
+
+    /**
+     * @brief Get the read only data element from row and column index.
+     *
+     * @param r The row index.
+     * @param c The column index.
+     * @return (T) The element value.
+     */
+    T operator()(size_t r, size_t c) const {
+        FLAMES_PRAGMA(INLINE)
+        assert(r < rows() && "Matrix row index should be within range");
+        assert(c < cols() && "Matrix col index should be within range");
+        return _L(r / rows_R, c / cols_R) * _R(r % rows_R, c % cols_R);
+    }
+
+    /**
+     * @brief Convert the Kronecker product to a dense Mat.
+     *
+     * @return (Mat<T, rows(), cols()>) The dense matrix.
+     */
+    Mat<T, rows_L * rows_R, cols_L * cols_R> asMat() const {
+        Mat<T, rows_L * rows_R, cols_L * cols_R> mat;
+    MAT_KRON_AS_MAT:
+        for (size_t r = 0; r != rows(); ++r) {
+            for (size_t c = 0; c != cols(); ++c) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_COPY_UNROLL_FACTOR)
+                FLAMES_PRAGMA(LOOP_FLATTEN)
+                mat(r, c) = (*this)(r, c);
+            }
+        }
+        return mat;
+    }
+
+    /**
+     * @brief Print the Kronecker product (as a dense matrix).
+     *
+     * @param title The title to be printed.
+     * @param os The output stream.
+     */
+    void print(const std::string& title = "", std::ostream& os = std::cout) const { asMat().print(title, os); }
+
+  private:
+    FactorL _L;
+    FactorR _R;
+};
+
+/**
+ * @brief Construct a Kronecker product from its two factors.
+ *
+ * @tparam T Element type.
+ * @tparam rows_L The number of rows of the left factor.
+ * @tparam cols_L The number of columns of the left factor.
+ * @tparam type_L The MatType of the left factor.
+ * @tparam rows_R The number of rows of the right factor.
+ * @tparam cols_R The number of columns of the right factor.
+ * @tparam type_R The MatType of the right factor.
+ * @param mat_L The left factor.
+ * @param mat_R The right factor.
+ * @return (MatKron) The Kronecker product `mat_L ⊗ mat_R`.
+ */
+template <typename T, size_t rows_L, size_t cols_L, MatType type_L, size_t rows_R, size_t cols_R, MatType type_R>
+static inline MatKron<T, rows_L, cols_L, type_L, rows_R, cols_R, type_R> kron(
+    const Mat<T, rows_L, cols_L, type_L>& mat_L, const Mat<T, rows_R, cols_R, type_R>& mat_R) {
+    return MatKron<T, rows_L, cols_L, type_L, rows_R, cols_R, type_R>(mat_L, mat_R);
+}
+
+/**
+ * @brief Kronecker product times a matrix (or vector).
+ *
+ * @details Each column x of the right matrix is regarded as X (cols_L x cols_R, row major),
+ *          and the result column is computed as `vec(A X B^T)`, i.e.
+ *          the right factor is applied first and then the left factor.
+ *          No dense Kronecker product is formed.
+ *          You may configure `FLAMES_MAT_KRON_UNROLL_FACTOR`
+ *          or `FLAMES_UNROLL_FACTOR` to doing multiplication in parallel.
+ * @tparam T Element type.
+ * @tparam rows_L The number of rows of the left factor.
+ * @tparam cols_L The number of columns of the left factor.
+ * @tparam type_L The MatType of the left factor.
+ * @tparam rows_R The number of rows of the right factor.
+ * @tparam cols_R The number of columns of the right factor.
+ * @tparam type_R The MatType of the right factor.
+ * @tparam M The right matrix type.
+ * @tparam _unused (unused)
+ * @tparam T2 The right matrix element type.
+ * @tparam n_rows The row number of the right matrix (should be cols_L * cols_R).
+ * @tparam n_cols The column number of the right matrix.
+ * @tparam type2 The right matrix MatType.
+ * @param kr The Kronecker product.
+ * @param mat The right matrix (or vector).
+ * @return (Mat<T, rows_L * rows_R, n_cols>) The multiplication result.
+ */
+template <typename T, size_t rows_L, size_t cols_L, MatType type_L, size_t rows_R, size_t cols_R, MatType type_R,
+          template <class, size_t, size_t, MatType, class...> typename M, typename... _unused, typename T2,
+          size_t n_rows, size_t n_cols, MatType type2>
+static inline Mat<T, rows_L * rows_R, n_cols> operator*(
+    const MatKron<T, rows_L, cols_L, type_L, rows_R, cols_R, type_R>& kr,
+    const M<T2, n_rows, n_cols, type2, _unused...>& mat) {
+    static_assert(n_rows == cols_L * cols_R, "Matrix dimension should meet.");
+    const auto& mat_L = kr.factorL();
+    const auto& mat_R = kr.factorR();
+    Mat<T, rows_L * rows_R, n_cols> result;
+    Mat<T, cols_L, rows_R> tmp;
+MAT_KRON_TIMES_MAT:
+    for (size_t k = 0; k != n_cols; ++k) {
+    // tmp = X * B^T
+    MAT_KRON_TIMES_MAT_R:
+        for (size_t j = 0; j != cols_R; ++j) {
+            for (size_t i = 0; i != cols_L; ++i) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_KRON_UNROLL_FACTOR)
+                for (size_t s = 0; s != rows_R; ++s) {
+                    FLAMES_PRAGMA(LOOP_FLATTEN)
+                    if (j == 0) tmp(i, s) = T(0);
+                    tmp(i, s) += mat(i * cols_R + j, k) * mat_R(s, j);
+                }
+            }
+        }
+    // vec(result) = vec(A * tmp)
+    MAT_KRON_TIMES_MAT_L:
+        for (size_t i = 0; i != cols_L; ++i) {
+            for (size_t r = 0; r != rows_L; ++r) {
+                FLAMES_PRAGMA(UNROLL factor = FLAMES_MAT_KRON_UNROLL_FACTOR)
+                for (size_t s = 0; s != rows_R; ++s) {
+                    FLAMES_PRAGMA(LOOP_FLATTEN)
+                    if (i == 0) result(r * rows_R + s, k) = T(0);
+                    result(r * rows_R + s, k) += mat_L(r, i) * tmp(i, s);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+} // namespace flames
+
+#endif